@@ -0,0 +1,197 @@
+/**
+ * @file AllocationTracker.h
+ * @brief Heap allocation tracker definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef ALLOCATIONTRACKER_H
+#define ALLOCATIONTRACKER_H
+
+#include <QString>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief What a thread is doing when it allocates
+ *
+ * The TICK_ entries follow TickPhase in order, so the engine maps one to the other by offset.
+ */
+enum class AllocationPhase : std::uint8_t {
+    OTHER,                  ///< Outside every tracked phase
+    TICK_TIMERS,            ///< TickPhase::TIMERS
+    TICK_INPUT,             ///< TickPhase::INPUT
+    TICK_BOTS,              ///< TickPhase::BOTS
+    TICK_STREAMING,         ///< TickPhase::STREAMING
+    TICK_PLAYER_MOVEMENT,   ///< TickPhase::PLAYER_MOVEMENT
+    TICK_INTEGRATION,       ///< TickPhase::INTEGRATION
+    TICK_PLAYER_CONTACTS,   ///< TickPhase::PLAYER_CONTACTS
+    TICK_PROJECTILES,       ///< TickPhase::PROJECTILES
+    TICK_ITEMS,             ///< TickPhase::ITEMS
+    TICK_BOUNDS,            ///< TickPhase::BOUNDS
+    TICK_PLAYER_HOT_STATE,  ///< TickPhase::PLAYER_HOT_STATE
+    TICK_HITS,              ///< TickPhase::HITS
+    TICK_FLUSH,             ///< TickPhase::FLUSH
+    TICK_GAME_OVER,         ///< TickPhase::GAME_OVER
+    RENDER_WORLD,           ///< Background, platforms, players and entities
+    RENDER_HUD,             ///< Health bars, weapon info, statistics and overlays
+    COUNT                   ///< Number of phases
+};
+
+/**
+ * @brief Heap traffic of one phase
+ */
+struct AllocationCounts {
+    std::uint64_t allocations;      ///< operator new calls
+    std::uint64_t bytes;            ///< Bytes requested from operator new
+    std::uint64_t deallocations;    ///< operator delete calls
+};
+
+/**
+ * @brief Heap traffic of every phase
+ */
+using AllocationSnapshot = std::array<AllocationCounts, static_cast<std::size_t>(AllocationPhase::COUNT)>;
+
+/**
+ * @brief Heap allocation tracker
+ *
+ * Builds configured with QTGAME_ALLOC_TRACKING link src/AllocationHooks.cpp into the game and
+ * the allocation check; it replaces the global operator new and delete there and counts every
+ * call against the phase of the calling thread. libqtgame_sim leaves the allocator of its host
+ * alone, so its counts stay zero. Threads enter phases through Scope
+ * objects; job system threads take over the phase of the thread that queued their chunk. In
+ * other builds phases are still entered but nothing is counted.
+ */
+class AllocationTracker {
+public:
+    /**
+     * @brief Puts the calling thread in a phase until destroyed
+     */
+    class Scope {
+    public:
+        /**
+         * @brief Constructor, enters the phase
+         * @param phase The phase
+         */
+        explicit Scope(AllocationPhase phase) : m_previous(enter(phase)) {}
+
+        /**
+         * @brief Destructor, returns to the previous phase
+         */
+        ~Scope() { enter(m_previous); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        AllocationPhase m_previous; ///< Phase restored on exit
+    };
+
+    /**
+     * @brief Whether allocations are counted in this build
+     * @return bool Whether built with QTGAME_ALLOC_TRACKING
+     */
+    static constexpr bool isEnabled() {
+#ifdef QTGAME_ALLOC_TRACKING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Put the calling thread in a phase
+     * @param phase The phase
+     * @return AllocationPhase The phase the thread was in
+     */
+    static AllocationPhase enter(AllocationPhase phase);
+
+    /**
+     * @brief Get the phase of the calling thread
+     * @return AllocationPhase Current phase
+     */
+    static AllocationPhase getPhase();
+
+    /**
+     * @brief Count an allocation in the phase of the calling thread (called by operator new)
+     * @param bytes Requested size
+     */
+    static void recordAllocation(std::size_t bytes);
+
+    /**
+     * @brief Count a deallocation in the phase of the calling thread (called by operator delete)
+     */
+    static void recordDeallocation();
+
+    /**
+     * @brief Totals of every phase since the program started
+     * @return AllocationSnapshot Counts per phase (all zero when not enabled)
+     */
+    static AllocationSnapshot snapshot();
+
+    /**
+     * @brief Counts of every phase between two snapshots
+     * @param before Earlier snapshot
+     * @param after Later snapshot
+     * @return AllocationSnapshot Differences per phase
+     */
+    static AllocationSnapshot difference(const AllocationSnapshot& before, const AllocationSnapshot& after);
+
+    /**
+     * @brief Sum of some phases of a snapshot
+     * @param counts Counts per phase
+     * @param first First phase
+     * @param last Last phase (inclusive)
+     * @return AllocationCounts Summed counts
+     */
+    static AllocationCounts sum(const AllocationSnapshot& counts, AllocationPhase first, AllocationPhase last);
+
+    /**
+     * @brief Get the name of a phase
+     * @param phase The phase
+     * @return const char* Lowercase name, e.g. "tick_hits"
+     */
+    static const char* getPhaseName(AllocationPhase phase);
+};
+
+/**
+ * @brief Per-frame allocation counts of the last frames
+ *
+ * recordFrame() takes the counts since the previous call into a ring buffer allocated up
+ * front, so recording does not itself allocate.
+ */
+class AllocationTrace {
+public:
+    static constexpr int CAPACITY = 600;   ///< Frames kept (10 seconds at 60 Hz)
+
+    /**
+     * @brief Constructor
+     */
+    AllocationTrace();
+
+    /**
+     * @brief Close a frame: record the counts since the previous call
+     */
+    void recordFrame();
+
+    /**
+     * @brief Export the kept frames as CSV, one row per frame and three columns per phase
+     * @param path Output file path
+     * @return bool Whether the file was written
+     */
+    bool exportTrace(const QString& path) const;
+
+    // Getter methods
+    const AllocationSnapshot& getLastFrame() const { return m_lastFrame; }
+    long long getFrameCount() const { return m_frameCount; }
+
+private:
+    std::vector<AllocationSnapshot> m_frames;  ///< Ring buffer of per-frame counts
+    AllocationSnapshot m_previous;             ///< Totals at the end of the previous frame
+    AllocationSnapshot m_lastFrame;            ///< Counts of the last frame
+    long long m_frameCount;                    ///< Frames recorded so far
+};
+
+#endif // ALLOCATIONTRACKER_H
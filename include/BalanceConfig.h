@@ -0,0 +1,116 @@
+/**
+ * @file BalanceConfig.h
+ * @brief Runtime balance parameter overlay definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef BALANCECONFIG_H
+#define BALANCECONFIG_H
+
+#include "Weapon.h"
+#include <QString>
+#include <limits>
+
+/**
+ * @brief Balance parameters that can be changed without recompiling
+ *
+ * Starts as a copy of the compile-time values in GameConfig and WEAPON_SPECS. Each engine
+ * holds its own copy, so concurrent headless matches can run with different parameters.
+ * Parameters are addressed by their GameConfig names (e.g. "RIFLE_DAMAGE"); values that
+ * only exist in WEAPON_SPECS are named "<WEAPON>_RANGE", "SNIPER_SPEED" and "<WEAPON>_HITSCAN".
+ */
+struct BalanceConfig {
+    WeaponSpec weapons[WEAPON_TYPE_COUNT];   ///< Weapon parameters, indexed by WeaponType
+    int bandageHeal;                         ///< Bandage healing amount
+    int medkitHeal;                          ///< Medical kit healing amount
+    int adrenalineHeal;                      ///< Adrenaline healing per second
+    int adrenalineDuration;                  ///< Adrenaline duration (milliseconds)
+    double adrenalineSpeedMultiplier;        ///< Adrenaline speed multiplier
+    int itemDropInterval;                    ///< Item drop interval (milliseconds)
+
+    /**
+     * @brief Constructor, takes the compile-time defaults
+     */
+    BalanceConfig();
+
+    /**
+     * @brief Get the shared default parameters
+     * @return const BalanceConfig& Defaults
+     */
+    static const BalanceConfig& defaults();
+
+    /**
+     * @brief Set a parameter by name
+     * @param name Parameter name
+     * @param value New value (rounded for integer parameters)
+     * @param error Receives a message on failure (optional)
+     * @return bool Whether the parameter exists and the value is finite and in its range
+     */
+    bool set(const QString& name, double value, QString* error = nullptr);
+
+    /**
+     * @brief Apply a comma separated list of NAME=value assignments
+     * @param text Assignments, e.g. "RIFLE_DAMAGE=25,SNIPER_COOLDOWN=1500"
+     * @param error Receives a message on failure (optional)
+     * @return bool Whether every assignment was applied
+     */
+    bool parse(const QString& text, QString* error = nullptr);
+
+    /**
+     * @brief Visit every parameter with its name and valid range
+     *
+     * Damage and healing beyond the maximum health change nothing and would overflow the
+     * health arithmetic, so they are capped there; an ammo of -1 means infinite.
+     * @param visit Called as visit(const char* name, int& value, double min, double max) or with
+     *        a double& value
+     */
+    template<typename Visitor>
+    void visitParameters(Visitor&& visit) {
+        constexpr double HP = GameConfig::PLAYER_MAX_HP;
+        constexpr double INT = std::numeric_limits<int>::max();
+        constexpr double REAL = std::numeric_limits<double>::max();
+
+        WeaponSpec& fist = weapons[static_cast<int>(WeaponType::FIST)];
+        WeaponSpec& knife = weapons[static_cast<int>(WeaponType::KNIFE)];
+        WeaponSpec& ball = weapons[static_cast<int>(WeaponType::BALL)];
+        WeaponSpec& rifle = weapons[static_cast<int>(WeaponType::RIFLE)];
+        WeaponSpec& sniper = weapons[static_cast<int>(WeaponType::SNIPER)];
+
+        visit("FIST_DAMAGE", fist.damage, 0, HP);
+        visit("FIST_COOLDOWN", fist.cooldown, 0, INT);
+        visit("FIST_RANGE", fist.range, 0, REAL);
+        visit("KNIFE_DAMAGE", knife.damage, 0, HP);
+        visit("KNIFE_COOLDOWN", knife.cooldown, 0, INT);
+        visit("KNIFE_RANGE", knife.range, 0, REAL);
+        visit("BALL_DAMAGE", ball.damage, 0, HP);
+        visit("BALL_COOLDOWN", ball.cooldown, 0, INT);
+        visit("BALL_COUNT", ball.ammo, -1, INT);
+        visit("BALL_THROW_SPEED", ball.projectileSpeed, 0, REAL);
+        visit("RIFLE_DAMAGE", rifle.damage, 0, HP);
+        visit("RIFLE_COOLDOWN", rifle.cooldown, 0, INT);
+        visit("RIFLE_AMMO", rifle.ammo, -1, INT);
+        visit("BULLET_SPEED", rifle.projectileSpeed, 0, REAL);
+        visit("RIFLE_HITSCAN", rifle.hitscan, 0, 1);
+        visit("SNIPER_DAMAGE", sniper.damage, 0, HP);
+        visit("SNIPER_COOLDOWN", sniper.cooldown, 0, INT);
+        visit("SNIPER_AMMO", sniper.ammo, -1, INT);
+        visit("SNIPER_SPEED", sniper.projectileSpeed, 0, REAL);
+        visit("SNIPER_HITSCAN", sniper.hitscan, 0, 1);
+        visit("BANDAGE_HEAL", bandageHeal, 0, HP);
+        visit("MEDKIT_HEAL", medkitHeal, 0, HP);
+        visit("ADRENALINE_HEAL", adrenalineHeal, 0, HP);
+        visit("ADRENALINE_DURATION", adrenalineDuration, 0, INT);
+        visit("ADRENALINE_SPEED_MULTIPLIER", adrenalineSpeedMultiplier, 0, REAL);
+        visit("ITEM_DROP_INTERVAL", itemDropInterval, 0, INT);
+    }
+
+    /**
+     * @brief Get the spec of a weapon type
+     * @param type Weapon type
+     * @return const WeaponSpec& Parameters
+     */
+    const WeaponSpec& getWeapon(WeaponType type) const { return weapons[static_cast<int>(type)]; }
+};
+
+#endif // BALANCECONFIG_H
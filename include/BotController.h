@@ -0,0 +1,163 @@
+/**
+ * @file BotController.h
+ * @brief Scripted bot controller definitions
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef BOTCONTROLLER_H
+#define BOTCONTROLLER_H
+
+#include "Vector2D.h"
+#include "InputQueue.h"
+#include "RandomStream.h"
+#include "StateBuffer.h"
+#include <memory>
+#include <QString>
+
+/**
+ * @brief What a bot sees of the game for one player
+ *
+ * Built by GameEngine::observe() each tick before the bot decides.
+ */
+struct BotObservation {
+    Vector2D position;          ///< Own position
+    Vector2D velocity;          ///< Own velocity
+    bool grounded;              ///< Whether on ground
+    bool facingRight;           ///< Whether facing right
+    int hp;                     ///< Own health points
+    bool melee;                 ///< Whether the weapon is a melee weapon
+    double attackRange;         ///< Weapon range
+    bool canAttack;             ///< Ammunition left and cooldown elapsed
+
+    bool hasOpponent;           ///< Whether a visible opponent is alive
+    Vector2D opponentPosition;  ///< Nearest visible opponent position
+    double opponentDistance;    ///< Distance to the nearest visible opponent
+
+    bool hasItem;               ///< Whether an item is on the field
+    Vector2D itemPosition;      ///< Nearest item position
+    double itemDistance;        ///< Distance to the nearest item
+};
+
+/**
+ * @brief Bot type enumeration
+ */
+enum class BotType {
+    AGGRESSIVE,      ///< Chases and attacks the nearest opponent
+    ITEM_COLLECTOR,  ///< Collects items, fights when none are left
+    RANDOM           ///< Holds random action sets
+};
+
+/**
+ * @brief Bot controller interface
+ *
+ * Produces the held actions of one player per tick. The engine applies them through
+ * GameEngine::setPlayerActions(), so a bot drives a player exactly like held keys do:
+ * jump, crouch and fire act on the press edge and must be released to repeat.
+ */
+class BotController {
+public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~BotController() = default;
+
+    /**
+     * @brief Choose the actions held during the next tick
+     * @param observation Current observation of the controlled player
+     * @return ActionMask Held actions
+     */
+    virtual ActionMask decide(const BotObservation& observation) = 0;
+
+    /**
+     * @brief Get the bot type
+     * @return BotType The type createBot() builds this bot for
+     */
+    virtual BotType getType() const = 0;
+
+    /**
+     * @brief Write the bot's memory
+     * @param writer State writer
+     */
+    virtual void saveState(StateWriter& writer) const = 0;
+
+    /**
+     * @brief Restore memory written by saveState() of a bot of the same type
+     * @param reader State reader
+     * @return bool Whether the state was read completely and is in range
+     */
+    virtual bool restoreState(StateReader& reader) = 0;
+};
+
+/**
+ * @brief Bot that chases the nearest opponent and attacks whenever it can
+ */
+class AggressiveBot : public BotController {
+public:
+    ActionMask decide(const BotObservation& observation) override;
+    BotType getType() const override { return BotType::AGGRESSIVE; }
+    void saveState(StateWriter& writer) const override;
+    bool restoreState(StateReader& reader) override;
+
+private:
+    ActionMask m_last = Action::NONE;  ///< Actions held last tick
+};
+
+/**
+ * @brief Bot that walks to the nearest item and picks it up, fighting like AggressiveBot otherwise
+ */
+class ItemCollectorBot : public BotController {
+public:
+    ActionMask decide(const BotObservation& observation) override;
+    BotType getType() const override { return BotType::ITEM_COLLECTOR; }
+    void saveState(StateWriter& writer) const override;
+    bool restoreState(StateReader& reader) override;
+
+private:
+    AggressiveBot m_fallback;          ///< Behavior when no item is on the field
+    ActionMask m_last = Action::NONE;  ///< Actions held last tick
+};
+
+/**
+ * @brief Bot that holds random action sets for random durations
+ */
+class RandomBot : public BotController {
+public:
+    /**
+     * @brief Constructor
+     * @param seed Random seed
+     * @param stream Stream index, so bots sharing a seed choose independently
+     */
+    explicit RandomBot(std::uint64_t seed, std::uint64_t stream = 0);
+
+    ActionMask decide(const BotObservation& observation) override;
+    BotType getType() const override { return BotType::RANDOM; }
+    void saveState(StateWriter& writer) const override;
+    bool restoreState(StateReader& reader) override;
+
+private:
+    static constexpr int MAX_HOLD_TICKS = 60; ///< Longest hold of one action set
+
+    RandomStream m_random;               ///< Random stream (RandomPurpose::BOT)
+    ActionMask m_current = Action::NONE; ///< Held action set
+    int m_holdTicks = 0;                 ///< Ticks left before choosing a new set
+};
+
+/**
+ * @brief Create a bot
+ * @param type Bot type
+ * @param seed Random seed (used by RandomBot)
+ * @param stream Random stream index, e.g. the player index (used by RandomBot)
+ * @return std::unique_ptr<BotController> The bot
+ */
+std::unique_ptr<BotController> createBot(BotType type, std::uint64_t seed = 0, std::uint64_t stream = 0);
+
+/**
+ * @brief Parse a bot type name ("aggressive", "collector" or "random")
+ * @param name Type name
+ * @param type Receives the type
+ * @return bool Whether the name is known
+ */
+bool parseBotType(const QString& name, BotType& type);
+
+#endif // BOTCONTROLLER_H
@@ -0,0 +1,221 @@
+/**
+ * @file ChunkStreamer.h
+ * @brief Chunk streamer class definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef CHUNKSTREAMER_H
+#define CHUNKSTREAMER_H
+
+#include "Level.h"
+#include "Vector2D.h"
+#include "StateBuffer.h"
+#include "Raycast.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Region of the world that must stay resident
+ */
+struct StreamRegion {
+    Vector2D min;  ///< Minimum corner
+    Vector2D max;  ///< Maximum corner
+};
+
+/**
+ * @brief Chunk streamer
+ *
+ * Keeps the level chunks overlapping a set of focus regions resident and maintains the list
+ * of platforms touching them. Only resident chunks take part in collision queries, so the
+ * per-tick cost and the memory held follow the area around the players, not the world size.
+ */
+class ChunkStreamer {
+public:
+    /**
+     * @brief Constructor
+     * @param level The level to stream
+     */
+    explicit ChunkStreamer(const Level& level);
+
+    /**
+     * @brief Evict all chunks and size the bookkeeping for the current level
+     */
+    void reset();
+
+    /**
+     * @brief Page chunks in and out so exactly those overlapping the regions are resident
+     * @param regions Focus regions
+     * @return bool Whether the active platform list changed
+     */
+    bool update(const std::vector<StreamRegion>& regions);
+
+    /**
+     * @brief Check if the chunk containing a point is resident
+     * @param point World position (clamped to the world)
+     * @return bool Whether the chunk is resident
+     */
+    bool isResident(const Vector2D& point) const;
+
+    /**
+     * @brief Check if a platform touches a resident chunk
+     * @param index Platform index
+     * @return bool Whether the platform is active
+     */
+    bool isPlatformActive(std::uint32_t index) const {
+        return index < m_active.size() && m_active[index].references > 0;
+    }
+
+    /**
+     * @brief Visit the platforms registered in resident grid cells overlapping a box
+     *
+     * A platform spanning several cells may be visited more than once.
+     * @param min Box minimum corner
+     * @param max Box maximum corner
+     * @param visit Called with each platform index; returning true stops the query
+     * @return bool Whether the query was stopped by the visitor
+     */
+    template<typename Visitor>
+    bool queryPlatforms(const Vector2D& min, const Vector2D& max, Visitor&& visit) const {
+        int perChunk = static_cast<int>(m_level.getCellsPerChunk());
+        double cellSize = m_level.getChunkSize() / perChunk;
+        int lastCellX = static_cast<int>(m_level.getChunkColumns()) * perChunk - 1;
+        int lastCellY = static_cast<int>(m_level.getChunkRows()) * perChunk - 1;
+        int minX = std::clamp(static_cast<int>(std::floor(min.x / cellSize)), 0, lastCellX);
+        int maxX = std::clamp(static_cast<int>(std::floor(max.x / cellSize)), 0, lastCellX);
+        int minY = std::clamp(static_cast<int>(std::floor(min.y / cellSize)), 0, lastCellY);
+        int maxY = std::clamp(static_cast<int>(std::floor(max.y / cellSize)), 0, lastCellY);
+
+        for (int chunkY = minY / perChunk; chunkY <= maxY / perChunk; ++chunkY) {
+            for (int chunkX = minX / perChunk; chunkX <= maxX / perChunk; ++chunkX) {
+                std::uint32_t chunk = static_cast<std::uint32_t>(chunkY) * m_level.getChunkColumns() + chunkX;
+                if (!isChunkResident(chunk)) continue;
+
+                // Cell range of the box inside this chunk
+                const LevelFormat::GridCell* cells = m_level.getChunkCells(chunk);
+                int localMinX = std::max(minX - chunkX * perChunk, 0);
+                int localMaxX = std::min(maxX - chunkX * perChunk, perChunk - 1);
+                int localMinY = std::max(minY - chunkY * perChunk, 0);
+                int localMaxY = std::min(maxY - chunkY * perChunk, perChunk - 1);
+
+                for (int cy = localMinY; cy <= localMaxY; ++cy) {
+                    for (int cx = localMinX; cx <= localMaxX; ++cx) {
+                        const LevelFormat::GridCell& cell = cells[cy * perChunk + cx];
+                        for (std::uint32_t i = 0; i < cell.count; ++i) {
+                            if (visit(m_level.getIndex(cell.first + i))) return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Find the highest platform top edge in a band of resident chunks
+     *
+     * Binary searches the surface columns under the horizontal range, so the cost does not
+     * depend on how many platforms are nearby.
+     * @param minX Left end of the range (exclusive)
+     * @param maxX Right end of the range (exclusive)
+     * @param minTop Highest top edge accepted
+     * @param maxTop Lowest top edge accepted
+     * @return std::int32_t Platform index, ties going to the lowest (-1: none)
+     */
+    std::int32_t findSurface(double minX, double maxX, double minTop, double maxTop) const;
+
+    /**
+     * @brief Find the first platform of resident chunks hit by a ray
+     *
+     * Walks the collision grid cells along the ray in order and stops at the first cell
+     * that ends behind the nearest hit, so only platforms near the ray are tested.
+     * @param origin Ray origin
+     * @param direction Unit ray direction
+     * @param maxDistance Ray length
+     * @param radius Radius of the cast circle (0 for a thin ray)
+     * @param hit Receives the nearest hit (ties going to the lowest platform index)
+     * @return bool Whether a platform was hit
+     */
+    bool raycastPlatforms(const Vector2D& origin, const Vector2D& direction, double maxDistance, double radius,
+                          RayHit& hit) const;
+
+    /**
+     * @brief Predict when a moving circle first touches a platform of the resident chunks
+     *
+     * The circle follows origin + velocity * t + (0, accelerationY) * t^2 / 2. Straight paths
+     * are cast in one go; curved paths are cast chord by chord, each staying within 0.01 px of
+     * the parabola and about one grid cell long.
+     * @param origin Center at time 0
+     * @param velocity Velocity at time 0
+     * @param accelerationY Vertical acceleration (0 for a straight path)
+     * @param radius Circle radius
+     * @param maxTime Prediction horizon in seconds
+     * @param time Receives the impact time in seconds
+     * @param platform Receives the platform hit
+     * @return bool Whether a platform is hit within maxTime
+     */
+    bool predictImpact(const Vector2D& origin, const Vector2D& velocity, double accelerationY, double radius,
+                       double maxTime, double& time, std::int32_t& platform) const;
+
+    /**
+     * @brief Write the resident chunks and platform bookkeeping
+     * @param writer State writer
+     */
+    void saveState(StateWriter& writer) const;
+
+    /**
+     * @brief Restore state written by saveState() for the same level
+     * @param reader State reader
+     * @return bool Whether the state was read completely and fits the level
+     */
+    bool restoreState(StateReader& reader);
+
+    // Getter methods
+    const std::vector<std::uint32_t>& getActivePlatforms() const { return m_activePlatforms; }
+    std::size_t getResidentChunkCount() const { return m_residentChunks.size(); }
+    std::size_t getRejectedChunkCount() const { return m_rejectedChunks.size(); }
+
+private:
+    /**
+     * @brief Check if a chunk is resident
+     * @param chunk Chunk index
+     * @return bool Whether the chunk is resident
+     */
+    bool isChunkResident(std::uint32_t chunk) const;
+
+    /**
+     * @brief Page a chunk in, activating its platforms
+     * 
+     * Chunks failing Level::isChunkValid() are rejected and never become resident.
+     * @param chunk Chunk index
+     * @return bool Whether a platform was activated
+     */
+    bool loadChunk(std::uint32_t chunk);
+
+    /**
+     * @brief Page a chunk out, deactivating platforms no other resident chunk touches
+     * @param chunk Chunk index
+     * @return bool Whether a platform was deactivated
+     */
+    bool evictChunk(std::uint32_t chunk);
+
+    /**
+     * @brief Platform reference count and position in the active list
+     */
+    struct ActiveEntry {
+        std::uint32_t references;  ///< Resident chunks touching the platform
+        std::size_t slot;          ///< Index in m_activePlatforms
+    };
+
+private:
+    const Level& m_level;                                      ///< Streamed level
+    std::vector<std::uint32_t> m_residentChunks;               ///< Resident chunks (sorted)
+    std::vector<std::uint32_t> m_wantedChunks;                 ///< Scratch list for update()
+    std::vector<std::uint8_t> m_wantedMarks;                   ///< Per chunk: already in m_wantedChunks
+    std::vector<std::uint32_t> m_activePlatforms;              ///< Platforms touching resident chunks
+    std::vector<ActiveEntry> m_active;                         ///< Bookkeeping per platform index (0 references: inactive)
+    std::vector<std::uint32_t> m_rejectedChunks;               ///< Chunks skipped as invalid (sorted)
+};
+
+#endif // CHUNKSTREAMER_H
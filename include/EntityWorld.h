@@ -0,0 +1,431 @@
+/**
+ * @file EntityWorld.h
+ * @brief Entity-component storage definitions
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef ENTITYWORLD_H
+#define ENTITYWORLD_H
+
+#include "Vector2D.h"
+#include "Weapon.h"
+#include "Item.h"
+#include "StateBuffer.h"
+#include "TimerWheel.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Entity identifier
+ */
+using Entity = std::uint32_t;
+
+constexpr Entity INVALID_ENTITY = 0xFFFFFFFFu; ///< Null entity
+
+/**
+ * @brief Sprite shape enumeration
+ */
+enum class SpriteShape {
+    RECT,       ///< Filled rectangle
+    ELLIPSE     ///< Filled ellipse
+};
+
+/**
+ * @brief Position and velocity component
+ */
+struct Motion {
+    Vector2D position;  ///< Position (top-left for boxes, center for circles)
+    Vector2D velocity;  ///< Velocity
+};
+
+/**
+ * @brief Collision shape component
+ */
+struct Body {
+    Vector2D offset;    ///< Bounds offset from position
+    Vector2D size;      ///< Bounds size
+    double radius;      ///< Circle radius around position (0 for boxes)
+};
+
+/**
+ * @brief World-space axis-aligned bounding box component
+ */
+struct Bounds {
+    Vector2D min;       ///< Top-left corner
+    Vector2D max;       ///< Bottom-right corner
+};
+
+/**
+ * @brief Gravity component
+ */
+struct Gravity {
+    double scale;       ///< Gravity multiplier
+    bool grounded;      ///< Whether resting on ground (no gravity applied)
+};
+
+/**
+ * @brief Lifetime component
+ * 
+ * The engine destroys the entity when the ENTITY_EXPIRY timer with this handle fires; a
+ * recycled entity id holds a different handle, so late events for the old entity are ignored.
+ */
+struct Lifetime {
+    TimerHandle timer;  ///< Expiry timer in the engine's TimerWheel
+};
+
+/**
+ * @brief Sprite component
+ */
+struct Sprite {
+    unsigned int color; ///< Fill color (0xRRGGBB)
+    SpriteShape shape;  ///< Shape
+    char label;         ///< Centered label character (0 for none)
+};
+
+/**
+ * @brief Projectile component
+ */
+struct ProjectileInfo {
+    int damage;         ///< Damage value
+    AmmoType type;      ///< Ammunition type
+    int ownerId;        ///< Owner player index
+    std::uint32_t teamMask; ///< Owner team bit, players of this team are not hit
+    std::int64_t expiry;    ///< Timer wheel time at which the projectile's lifetime ends
+};
+
+/**
+ * @brief Item component
+ */
+struct ItemInfo {
+    ItemType type;      ///< Item type
+};
+
+/**
+ * @brief Sparse-set component pool
+ * 
+ * Components are kept densely packed for iteration; a sparse array maps entity ids to dense
+ * indices for O(1) lookup, insertion and swap-remove. The dense range is split into awake
+ * components at the front and sleeping ones behind them, so systems that only care about
+ * moving entities iterate [0, awakeSize()) and resting entities cost nothing.
+ */
+template <typename T>
+class ComponentPool {
+public:
+    /**
+     * @brief Check if entity has this component
+     * @param entity The entity
+     * @return bool Whether present
+     */
+    bool has(Entity entity) const {
+        return entity < m_sparse.size() && m_sparse[entity] != INVALID_ENTITY;
+    }
+
+    /**
+     * @brief Add or replace component
+     * @param entity The entity
+     * @param component Component value
+     * @return T& Stored component
+     */
+    T& add(Entity entity, const T& component) {
+        if (has(entity)) {
+            return m_components[m_sparse[entity]] = component;
+        }
+        if (entity >= m_sparse.size()) {
+            m_sparse.resize(entity + 1, INVALID_ENTITY);
+        }
+        m_sparse[entity] = static_cast<Entity>(m_dense.size());
+        m_dense.push_back(entity);
+        m_components.push_back(component);
+        
+        // New components are awake: move in front of the sleeping ones
+        swapSlots(m_dense.size() - 1, m_awakeCount++);
+        return m_components[m_sparse[entity]];
+    }
+
+    /**
+     * @brief Remove component if present
+     * @param entity The entity
+     */
+    void remove(Entity entity) {
+        if (!has(entity)) return;
+        
+        // Move to the end of the awake range, then to the very end, keeping both ranges packed
+        std::size_t index = m_sparse[entity];
+        if (index < m_awakeCount) {
+            swapSlots(index, --m_awakeCount);
+            index = m_awakeCount;
+        }
+        swapSlots(index, m_dense.size() - 1);
+        m_dense.pop_back();
+        m_components.pop_back();
+        m_sparse[entity] = INVALID_ENTITY;
+    }
+
+    /**
+     * @brief Check if entity has this component and it is awake
+     * @param entity The entity
+     * @return bool Whether awake
+     */
+    bool isAwake(Entity entity) const {
+        return has(entity) && m_sparse[entity] < m_awakeCount;
+    }
+
+    /**
+     * @brief Move a component between the awake and sleeping ranges
+     * @param entity The entity (ignored if it has no component)
+     * @param awake Whether the component is awake from now on
+     */
+    void setAwake(Entity entity, bool awake) {
+        if (!has(entity)) return;
+        
+        std::size_t index = m_sparse[entity];
+        if (awake && index >= m_awakeCount) {
+            swapSlots(index, m_awakeCount++);
+        } else if (!awake && index < m_awakeCount) {
+            swapSlots(index, --m_awakeCount);
+        }
+    }
+
+    /**
+     * @brief Make room for components of entities below an id, so adding them does not allocate
+     * @param capacity Entity id limit
+     */
+    void reserve(std::size_t capacity) {
+        m_sparse.reserve(capacity);
+        m_dense.reserve(capacity);
+        m_components.reserve(capacity);
+    }
+
+    /**
+     * @brief Remove all components
+     */
+    void clear() {
+        m_sparse.clear();
+        m_dense.clear();
+        m_components.clear();
+        m_awakeCount = 0;
+    }
+
+    /**
+     * @brief Get component (entity must have it)
+     * @param entity The entity
+     * @return T& Component
+     */
+    T& get(Entity entity) { return m_components[m_sparse[entity]]; }
+    const T& get(Entity entity) const { return m_components[m_sparse[entity]]; }
+
+    /**
+     * @brief Get component if present
+     * @param entity The entity
+     * @return T* Component or nullptr
+     */
+    T* find(Entity entity) { return has(entity) ? &m_components[m_sparse[entity]] : nullptr; }
+    const T* find(Entity entity) const { return has(entity) ? &m_components[m_sparse[entity]] : nullptr; }
+
+    /**
+     * @brief Write the pool, keeping entity ids and dense order
+     * @param writer State writer
+     */
+    void saveState(StateWriter& writer) const {
+        writer.writeVector(m_sparse);
+        writer.writeVector(m_dense);
+        writer.writeVector(m_components);
+        writer.write(static_cast<std::uint32_t>(m_awakeCount));
+    }
+
+    /**
+     * @brief Replace the pool with a written one
+     * @param reader State reader
+     * @return bool Whether the pool was read completely and its sparse and dense indices match
+     */
+    bool restoreState(StateReader& reader) {
+        std::uint32_t awakeCount = 0;
+        if (!reader.readVector(m_sparse) || !reader.readVector(m_dense) || !reader.readVector(m_components) ||
+            !reader.read(awakeCount) || m_dense.size() != m_components.size() || awakeCount > m_dense.size()) {
+            return false;
+        }
+        m_awakeCount = awakeCount;
+        
+        // Every dense entry must be the one its entity points at, and every entity with a
+        // component must point at its own dense entry
+        for (std::size_t i = 0; i < m_dense.size(); ++i) {
+            if (m_dense[i] >= m_sparse.size() || m_sparse[m_dense[i]] != i) return false;
+        }
+        for (std::size_t entity = 0; entity < m_sparse.size(); ++entity) {
+            if (m_sparse[entity] == INVALID_ENTITY) continue;
+            if (m_sparse[entity] >= m_dense.size() || m_dense[m_sparse[entity]] != entity) return false;
+        }
+        return true;
+    }
+
+    // Dense iteration (awake components first)
+    std::size_t size() const { return m_dense.size(); }
+    std::size_t awakeSize() const { return m_awakeCount; }
+    Entity entityAt(std::size_t index) const { return m_dense[index]; }
+    T& at(std::size_t index) { return m_components[index]; }
+    const T& at(std::size_t index) const { return m_components[index]; }
+
+private:
+    /**
+     * @brief Exchange two dense slots
+     * @param a First dense index
+     * @param b Second dense index
+     */
+    void swapSlots(std::size_t a, std::size_t b) {
+        if (a == b) return;
+        std::swap(m_dense[a], m_dense[b]);
+        std::swap(m_components[a], m_components[b]);
+        m_sparse[m_dense[a]] = static_cast<Entity>(a);
+        m_sparse[m_dense[b]] = static_cast<Entity>(b);
+    }
+
+private:
+    std::vector<Entity> m_sparse;   ///< Entity id to dense index
+    std::vector<Entity> m_dense;    ///< Dense index to entity id
+    std::vector<T> m_components;    ///< Packed components
+    std::size_t m_awakeCount = 0;   ///< Awake components at the front of the dense arrays
+};
+
+/**
+ * @brief Entity-component world
+ * 
+ * Owns every simulated entity (players, projectiles, items) and the systems shared by all of
+ * them: gravity integration and bounding box update. Destruction is deferred
+ * so systems can queue removals while iterating.
+ */
+class EntityWorld {
+public:
+    /**
+     * @brief Constructor
+     */
+    EntityWorld();
+
+    /**
+     * @brief Create an entity
+     * @return Entity New entity id
+     */
+    Entity create();
+
+    /**
+     * @brief Queue an entity for destruction at the next flush
+     * @param entity The entity
+     */
+    void destroy(Entity entity);
+
+    /**
+     * @brief Destroy all queued entities
+     */
+    void flushDestroyed();
+
+    /**
+     * @brief Destroy every entity
+     */
+    void clear();
+
+    /**
+     * @brief Make room for a number of live entities in the id table and every pool
+     * 
+     * Capacity survives clear(), so rounds staying below it create entities without allocating.
+     * @param capacity Live entities
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Put an entity to rest
+     * 
+     * Its bounds are refreshed one last time, then it leaves integration, the bounds update
+     * and the awake item range until woken. Lifetimes and other components keep working.
+     * @param entity The entity
+     */
+    void sleep(Entity entity);
+
+    /**
+     * @brief Return a resting entity to the simulation
+     * @param entity The entity
+     */
+    void wake(Entity entity);
+
+    /**
+     * @brief Check if entity exists and is not queued for destruction
+     * @param entity The entity
+     * @return bool Whether alive
+     */
+    bool isAlive(Entity entity) const;
+
+    /**
+     * @brief Gravity integration system, advances every moving entity
+     * @param deltaTime Time delta in seconds
+     */
+    void integrate(double deltaTime);
+
+    /**
+     * @brief First half of integrate(): gravity on the awake gravity components in [begin, end)
+     * 
+     * Disjoint ranges touch disjoint entities and may run on different threads.
+     * @param deltaTime Time delta in seconds
+     * @param begin First dense index
+     * @param end One past the last dense index (at most gravities.awakeSize())
+     */
+    void applyGravity(double deltaTime, std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Second half of integrate(): move the awake motion components in [begin, end)
+     * @param deltaTime Time delta in seconds
+     * @param begin First dense index
+     * @param end One past the last dense index (at most motions.awakeSize())
+     */
+    void advanceMotions(double deltaTime, std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Bounding box system, recomputes bounds from motion and body
+     */
+    void updateBounds();
+
+    /**
+     * @brief Recompute the awake bounds in [begin, end); disjoint ranges may run on different threads
+     * @param begin First dense index
+     * @param end One past the last dense index (at most bounds.awakeSize())
+     */
+    void updateBounds(std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Write every entity and component
+     * @param writer State writer
+     */
+    void saveState(StateWriter& writer) const;
+
+    /**
+     * @brief Replace the world with a written one, keeping entity ids
+     * @param reader State reader
+     * @return bool Whether the world was read completely and its ids and pools are consistent
+     */
+    bool restoreState(StateReader& reader);
+
+    // Component pools
+    ComponentPool<Motion> motions;              ///< Position/velocity
+    ComponentPool<Body> bodies;                 ///< Collision shapes
+    ComponentPool<Bounds> bounds;               ///< World-space bounding boxes
+    ComponentPool<Gravity> gravities;           ///< Gravity-affected entities
+    ComponentPool<Lifetime> lifetimes;          ///< Expiring entities
+    ComponentPool<Sprite> sprites;              ///< Generic renderable entities
+    ComponentPool<ProjectileInfo> projectiles;  ///< Projectile data
+    ComponentPool<ItemInfo> items;              ///< Item data
+
+private:
+    /**
+     * @brief Entity slot state
+     */
+    enum class SlotState : std::uint8_t {
+        FREE,       ///< Unused id
+        ALIVE,      ///< Live entity
+        DYING       ///< Queued for destruction
+    };
+
+    std::vector<SlotState> m_slots;     ///< State per entity id
+    std::vector<Entity> m_freeIds;      ///< Recyclable ids
+    std::vector<Entity> m_destroyQueue; ///< Entities to destroy at next flush
+};
+
+#endif // ENTITYWORLD_H
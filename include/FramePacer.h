@@ -0,0 +1,131 @@
+/**
+ * @file FramePacer.h
+ * @brief Frame pacer class definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <QObject>
+#include <QTimer>
+#include <array>
+#include <chrono>
+
+/**
+ * @brief Frame pacer class
+ * 
+ * Drives the game loop at a fixed target refresh rate. A precise Qt timer sleeps until
+ * shortly before each frame deadline and the remaining time is spun away, so frames are
+ * emitted on an absolute schedule instead of accumulating timer rounding and jitter.
+ * The error between each frame's deadline and its actual emission time is recorded.
+ */
+class FramePacer : public QObject {
+    Q_OBJECT
+
+public:
+    using Clock = std::chrono::steady_clock; ///< Monotonic clock used for pacing
+
+    static constexpr int HISTORY_SIZE = 240; ///< Number of recorded pacing error samples
+
+    /**
+     * @brief Constructor
+     * @param parent Parent object
+     */
+    explicit FramePacer(QObject* parent = nullptr);
+
+    /**
+     * @brief Destructor
+     */
+    ~FramePacer();
+
+    /**
+     * @brief Start emitting frames
+     */
+    void start();
+
+    /**
+     * @brief Stop emitting frames
+     */
+    void stop();
+
+    /**
+     * @brief Set target refresh rate
+     * @param hz Target frames per second
+     */
+    void setTargetHz(int hz);
+
+    /**
+     * @brief Switch to the next supported refresh rate
+     * @return int New target frames per second
+     */
+    int cycleTargetHz();
+
+    /**
+     * @brief Clear recorded pacing statistics
+     */
+    void resetStatistics();
+
+    /**
+     * @brief Get mean absolute pacing error over the recorded history
+     * @return double Error in milliseconds
+     */
+    double getAverageError() const;
+
+    /**
+     * @brief Get maximum pacing error over the recorded history
+     * @return double Error in milliseconds
+     */
+    double getMaxError() const;
+
+    // Getter methods
+    bool isActive() const { return m_isActive; }
+    int getTargetHz() const { return m_targetHz; }
+    double getLastError() const { return m_lastError; }
+    long long getFrameCount() const { return m_frameCount; }
+    long long getMissedFrames() const { return m_missedFrames; }
+
+signals:
+    /**
+     * @brief Emitted once per paced frame
+     * @param deltaTime Time since previous frame in seconds
+     */
+    void frameReady(double deltaTime);
+
+private slots:
+    /**
+     * @brief Timer wake-up, spins to the deadline and emits the frame
+     */
+    void onTimerWake();
+
+private:
+    /**
+     * @brief Arm the timer for the next frame deadline
+     */
+    void scheduleNextFrame();
+
+    /**
+     * @brief Record pacing error of one frame
+     * @param errorMs Error in milliseconds
+     */
+    void recordError(double errorMs);
+
+private:
+    QTimer* m_timer;                     ///< Precise single-shot wake-up timer
+    bool m_isActive;                     ///< Whether pacing is running
+    int m_targetHz;                      ///< Target frames per second
+    Clock::duration m_period;            ///< Frame period
+    Clock::time_point m_nextDeadline;    ///< Deadline of the next frame
+    Clock::time_point m_lastFrameTime;   ///< Emission time of the previous frame
+
+    // Pacing statistics
+    std::array<double, HISTORY_SIZE> m_errorHistory; ///< Recent pacing errors in milliseconds
+    int m_historyIndex;                  ///< Next write position in history
+    int m_historyCount;                  ///< Number of valid history samples
+    double m_lastError;                  ///< Most recent pacing error in milliseconds
+    long long m_frameCount;              ///< Total emitted frames
+    long long m_missedFrames;            ///< Frames skipped because a deadline was overrun
+};
+
+#endif // FRAMEPACER_H
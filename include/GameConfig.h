@@ -21,6 +21,9 @@ public:
     static constexpr int WINDOW_WIDTH = 1200;     ///< Window width
     static constexpr int WINDOW_HEIGHT = 800;     ///< Window height
     static constexpr int TARGET_FPS = 60;         ///< Target frame rate
+    static constexpr int REFRESH_RATES[] = {60, 120, 144, 240}; ///< Selectable target frame rates
+    static constexpr int REFRESH_RATE_COUNT = 4;  ///< Number of selectable frame rates
+    static constexpr int FRAME_SPIN_THRESHOLD_US = 1500; ///< Busy-wait window before each frame deadline (microseconds)
 
     // Physics configuration
     static constexpr double GRAVITY = 800.0;      ///< Gravity acceleration (pixels/second²)
@@ -33,6 +36,8 @@ public:
     static constexpr int PLAYER_MAX_HP = 100;          ///< Player maximum health
     static constexpr double PLAYER_WIDTH = 40.0;       ///< Player width
     static constexpr double PLAYER_HEIGHT = 60.0;      ///< Player height
+    static constexpr int DEFAULT_PLAYER_COUNT = 2;     ///< Players in a keyboard match
+    static constexpr int MAX_TEAMS = 32;               ///< Team limit (one bit per team in team masks)
 
     // Terrain configuration
     static constexpr double ICE_SPEED_MULTIPLIER = 1.5; ///< Ice terrain speed multiplier
@@ -86,6 +91,14 @@ public:
     // Item drop configuration
     static constexpr int ITEM_DROP_INTERVAL = 3000;     ///< Item drop interval (milliseconds)
     static constexpr double ITEM_DROP_HEIGHT = 50.0;    ///< Item drop height
+    static constexpr double ITEM_FALL_SPEED = 200.0;    ///< Initial falling speed of dropped items
+    static constexpr int ITEM_LIFETIME = 30000;         ///< Item lifetime (milliseconds)
+    static constexpr int PROJECTILE_LIFETIME = 5000;    ///< Projectile maximum lifetime (milliseconds)
+    static constexpr int PROJECTILES_RESERVED_PER_PLAYER = RIFLE_AMMO; ///< Projectile slots reserved per player (a magazine in flight)
+
+    // World streaming configuration
+    static constexpr double CHUNK_STREAM_MARGIN = 512.0; ///< Distance around each player kept resident (pixels)
+    static constexpr double CAMERA_FOLLOW_RATE = 8.0;    ///< Camera catch-up rate (1/second)
 };
 
 #endif // GAMECONFIG_H 
\ No newline at end of file
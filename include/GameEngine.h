@@ -12,10 +12,19 @@
 #include "Weapon.h"
 #include "Item.h"
 #include "Vector2D.h"
+#include "EntityWorld.h"
+#include "TimerWheel.h"
+#include "InputQueue.h"
+#include "LatencyTracker.h"
+#include "Level.h"
+#include "ChunkStreamer.h"
+#include "BotController.h"
+#include "BalanceConfig.h"
+#include "StateBuffer.h"
+#include "RandomStream.h"
+#include "JobSystem.h"
 #include <vector>
 #include <memory>
-#include <random>
-#include <QTimer>
 #include <QObject>
 
 /**
@@ -27,6 +36,30 @@ enum class GameState {
     GAME_OVER   ///< Game over
 };
 
+/**
+ * @brief Phases of one GameEngine::update() tick, in serial order
+ *
+ * Every phase declares the state it reads and writes (see GameEngine.cpp). Phases are grouped
+ * into waves: a phase joins the first wave after every earlier phase it conflicts with, and
+ * the phases of one wave run concurrently.
+ */
+enum class TickPhase : std::uint8_t {
+    TIMERS,             ///< Fire due timers
+    INPUT,              ///< Apply queued input
+    BOTS,               ///< Apply bot actions
+    STREAMING,          ///< Page chunks, wake items and predict projectile impacts again
+    PLAYER_MOVEMENT,    ///< Turn held actions into player velocity and state
+    INTEGRATION,        ///< Gravity and motion of all awake entities
+    PLAYER_CONTACTS,    ///< World bounds and platform contacts per player
+    PROJECTILES,        ///< Drop projectiles in paged-out chunks
+    ITEMS,              ///< Item landing and sleeping
+    BOUNDS,             ///< Entity bounding boxes
+    PLAYER_HOT_STATE,   ///< Player hot state for the hit loops
+    HITS,               ///< Projectile-player hits
+    FLUSH,              ///< Remove destroyed entities
+    GAME_OVER           ///< Round end check
+};
+
 /**
  * @brief Platform structure
  */
@@ -35,15 +68,39 @@ struct Platform {
     double width;         ///< Width
     double height;        ///< Height
     TerrainType type;     ///< Terrain type
-    QColor color;         ///< Color
+    unsigned int color;   ///< Color (0xRRGGBB)
     
     /**
      * @brief Constructor
      */
-    Platform(const Vector2D& pos, double w, double h, TerrainType t, const QColor& c)
+    Platform(const Vector2D& pos, double w, double h, TerrainType t, unsigned int c)
         : position(pos), width(w), height(h), type(t), color(c) {}
 };
 
+/**
+ * @brief Per-tick player state laid out for the collision and attack loops
+ * 
+ * One entry per player, refreshed after movement so the hot loops read contiguous arrays
+ * instead of chasing Player objects.
+ */
+struct PlayerHotState {
+    std::vector<Vector2D> min;               ///< Bounding box minimum corner
+    std::vector<Vector2D> max;               ///< Bounding box maximum corner
+    std::vector<std::uint32_t> teamMask;     ///< Team bit
+    std::vector<std::uint8_t> targetable;    ///< Alive and not invisible
+    
+    /**
+     * @brief Resize all arrays
+     * @param count Number of players
+     */
+    void resize(std::size_t count) {
+        min.resize(count);
+        max.resize(count);
+        teamMask.resize(count);
+        targetable.resize(count);
+    }
+};
+
 /**
  * @brief Game engine class
  * 
@@ -63,11 +120,28 @@ public:
      */
     ~GameEngine();
 
+    /**
+     * @brief Set the number of players and teams used from the next initialize()
+     * 
+     * Players are assigned to teams round-robin. The first two players are bound to the keyboard.
+     * @param playerCount Number of players (at least 2)
+     * @param teamCount Number of teams; 0 gives every player its own team (capped at GameConfig::MAX_TEAMS)
+     */
+    void setPlayerCount(int playerCount, int teamCount = 0);
+
     /**
      * @brief Initialize the game
      */
     void initialize();
 
+    /**
+     * @brief Load a baked level file, used from the next initialize()
+     * @param path Level file path
+     * @param error Receives a message on failure (optional)
+     * @return bool Whether the level was loaded
+     */
+    bool loadLevel(const QString& path, QString* error = nullptr);
+
     /**
      * @brief Start the game
      */
@@ -85,42 +159,266 @@ public:
 
     /**
      * @brief Update game state
+     * 
+     * Runs the TickPhase waves in order. Per-player contacts, projectile and item updates,
+     * integration and hits are split into chunks on the job system; their side effects
+     * (destruction, damage) are buffered per chunk and applied in chunk order, so the result
+     * does not depend on the thread count.
      * @param deltaTime Time delta
      */
     void update(double deltaTime);
 
+    /**
+     * @brief Set the threads update() runs on
+     * @param threads Threads including the caller (1: everything on the calling thread, 0: one per core)
+     */
+    void setThreadCount(int threads);
+
     /**
      * @brief Handle key press events
+     * 
+     * The event is timestamped and queued; it takes effect at the start of the next tick.
      * @param key The pressed key
+     * @param timestamp Capture time in steady clock nanoseconds (0 stamps it now)
      */
-    void handleKeyPress(Qt::Key key);
+    void handleKeyPress(Qt::Key key, long long timestamp = 0);
 
     /**
      * @brief Handle key release events
+     * 
+     * The event is timestamped and queued; it takes effect at the start of the next tick.
      * @param key The released key
+     * @param timestamp Capture time in steady clock nanoseconds (0 stamps it now)
+     */
+    void handleKeyRelease(Qt::Key key, long long timestamp = 0);
+
+    /**
+     * @brief Set the held actions of a player directly, applying press/release edges
+     * @param playerIndex Player index
+     * @param actions Actions held from now on
+     */
+    void setPlayerActions(int playerIndex, ActionMask actions);
+
+    /**
+     * @brief Let a bot drive a player, replacing its keyboard or previous bot
+     * 
+     * The bot is kept across resets and decides at the start of every tick.
+     * @param playerIndex Player index
+     * @param bot The bot (nullptr returns the player to its previous input)
+     */
+    void setBot(int playerIndex, std::unique_ptr<BotController> bot);
+
+    /**
+     * @brief Build the bot observation of a player from the current state
+     * @param playerIndex Player index
+     * @return BotObservation Observation (zeroed for an unknown player)
      */
-    void handleKeyRelease(Qt::Key key);
+    BotObservation observe(int playerIndex) const;
+
+    /**
+     * @brief Find the first platform or targetable player hit by a ray
+     * 
+     * Platforms of resident chunks are found through the collision grid, players through the
+     * per-player hot state; a player is only hit in front of the nearest platform.
+     * @param origin Ray origin
+     * @param direction Ray direction (normalized internally)
+     * @param maxDistance Ray length
+     * @param radius Radius of the cast circle (0 for a thin ray)
+     * @param ignoreTeams Team bits whose players the ray passes through
+     * @param hit Receives the nearest hit
+     * @return bool Whether anything was hit
+     */
+    bool raycast(const Vector2D& origin, const Vector2D& direction, double maxDistance, double radius,
+                 std::uint32_t ignoreTeams, RayHit& hit) const;
+
+    /**
+     * @brief Write the complete simulation state
+     * 
+     * Covers players, entities, held actions, balance parameters, the random streams and the
+     * memory of attached bots, so a restored engine continues tick for tick like the original.
+     * Which bots are attached, queued key events and the level are not part of the state.
+     * @param writer State writer
+     */
+    void saveState(StateWriter& writer) const;
+
+    /**
+     * @brief Restore a state written by saveState()
+     * 
+     * The engine must have been initialized with the same level, player count and teams, and
+     * have bots of the same types attached to the same players.
+     * On failure the simulation state is undefined until the next initialize().
+     * @param reader State reader
+     * @return bool Whether the state matched this engine and was read completely
+     */
+    bool restoreState(StateReader& reader);
+
+    /**
+     * @brief Reseed the random streams used for item drops
+     * 
+     * Engines given the same seed and different match indices draw independent drops.
+     * @param seed Random seed
+     * @param match Match index within the seed
+     */
+    void setSeed(std::uint64_t seed, std::uint64_t match = 0);
+
+    /**
+     * @brief Replace the balance parameters
+     * 
+     * Players and their weapons read the engine's copy, so the change applies immediately;
+     * ammunition already held is kept until the next pickup or reset. Time already waited for
+     * the next item drop counts towards the new drop interval.
+     * @param balance Balance parameters
+     */
+    void setBalance(const BalanceConfig& balance);
+
+    /**
+     * @brief Set latency tracker notified when queued input is consumed
+     * @param tracker The tracker (nullptr disables tracking)
+     */
+    void setLatencyTracker(LatencyTracker* tracker) { m_latencyTracker = tracker; }
+
+    /**
+     * @brief Set the region shown on screen, kept resident in addition to the players' surroundings
+     * @param min Visible area minimum corner
+     * @param max Visible area maximum corner
+     */
+    void setViewRegion(const Vector2D& min, const Vector2D& max);
 
     // Getter methods
     GameState getGameState() const { return m_gameState; }
-    std::shared_ptr<Player> getPlayer1() const { return m_player1; }
-    std::shared_ptr<Player> getPlayer2() const { return m_player2; }
-    const std::vector<std::shared_ptr<Projectile>>& getProjectiles() const { return m_projectiles; }
-    const std::vector<std::shared_ptr<Item>>& getItems() const { return m_items; }
+    const std::vector<std::shared_ptr<Player>>& getPlayers() const { return m_players; }
+    std::shared_ptr<Player> getPlayer(int index) const;
+    int getPlayerCount() const { return static_cast<int>(m_players.size()); }
+    int getTeamCount() const { return m_teamCount; }
+    const EntityWorld& getWorld() const { return m_world; }
     const std::vector<Platform>& getPlatforms() const { return m_platforms; }
-    int getWinner() const { return m_winner; } // 0: no winner, 1: player1, 2: player2
+    const Level& getLevel() const { return m_level; }
+    const ChunkStreamer& getStreamer() const { return m_streamer; }
+    const BalanceConfig& getBalance() const { return m_balance; }
+    const TimerWheel& getTimers() const { return m_timers; }
+    int getThreadCount() const { return m_jobs->getThreadCount(); }
+    int getWinner() const { return m_winner; } // 0: no winner or draw, otherwise winning team index + 1
+
+private:
+    static constexpr std::uint32_t STATE_MAGIC = 0x37534751; ///< "QGS7", start of saveState() output
 
-private slots:
     /**
      * @brief Spawn random items
      */
     void spawnRandomItem();
 
-private:
     /**
-     * @brief Create map platforms
+     * @brief Schedule the next item drop BalanceConfig::itemDropInterval from now
+     * @param waited Time already waited for the drop (milliseconds)
+     */
+    void scheduleItemDrop(std::int64_t waited = 0);
+
+    /**
+     * @brief Advance the timer wheel, firing due events and removing expired entities
+     * @param deltaTime Time delta in seconds
+     */
+    void advanceTimers(double deltaTime);
+
+    /**
+     * @brief Dispatch a fired timer
+     * @param event The event
      */
-    void createPlatforms();
+    void onTimer(const TimerEvent& event);
+
+    /**
+     * @brief Apply the actions chosen by all bots
+     */
+    void updateBots();
+
+    /**
+     * @brief Run one phase of update()
+     * @param phase The phase
+     * @param deltaTime Time delta
+     */
+    void runPhase(TickPhase phase, double deltaTime);
+
+    /**
+     * @brief Give every job chunk room for the reserved entities
+     */
+    void reserveChunkBuffers();
+
+    /**
+     * @brief Page level chunks around the players and the view in and out
+     * 
+     * Rebuilds the platform list when the set of resident platforms changed.
+     * @return bool Whether the resident platforms changed
+     */
+    bool streamChunks();
+
+    /**
+     * @brief Rebuild the platform list from the resident platform records
+     */
+    void rebuildPlatforms();
+
+    /**
+     * @brief Wake every resting item so it falls again if its platform is gone
+     */
+    void wakeItems();
+
+    /**
+     * @brief Schedule the removal of a projectile
+     * 
+     * Predicts from the projectile's current motion when it first touches a resident platform
+     * or leaves the world, and points its lifetime timer at that moment (or at the end of its
+     * lifetime if that comes first). The timer fires at the start of the tick after the one that
+     * reaches the impact, so platforms are never tested per tick and cannot be tunneled through.
+     * @param entity Projectile entity
+     */
+    void scheduleProjectileRemoval(Entity entity);
+
+    /**
+     * @brief Apply all queued input events
+     */
+    void processInput();
+
+    /**
+     * @brief Apply one player action edge
+     * @param playerIndex Player index
+     * @param action Action bit
+     * @param pressed Whether the action started or ended
+     */
+    void applyPlayerAction(int playerIndex, ActionMask action, bool pressed);
+
+    /**
+     * @brief Try to pick up an item near the player
+     * @param player The player
+     */
+    void tryPickupItem(std::shared_ptr<Player> player);
+
+    /**
+     * @brief Refresh the per-player hot state from the players
+     */
+    void refreshPlayerHotState();
+
+    /**
+     * @brief End the round when at most one team has living players
+     */
+    void checkGameOver();
+
+    /**
+     * @brief Spawn a projectile entity
+     * @param launch Launch parameters
+     */
+    void spawnProjectile(const ProjectileLaunch& launch);
+
+    /**
+     * @brief Resolve a hitscan shot at once, damaging the first player along its path
+     * @param launch Launch parameters of the bullet it replaces
+     * @param range Shot range
+     */
+    void fireHitscan(const ProjectileLaunch& launch, double range);
+
+    /**
+     * @brief Spawn an item entity
+     * @param type Item type
+     * @param position Drop position
+     */
+    void spawnItem(ItemType type, const Vector2D& position);
 
     /**
      * @brief Update physics system
@@ -129,37 +427,53 @@ private:
     void updatePhysics(double deltaTime);
 
     /**
-     * @brief Update projectiles
+     * @brief Remove projectiles that entered paged-out chunks
      * @param deltaTime Time delta
      */
     void updateProjectiles(double deltaTime);
 
     /**
-     * @brief Update items
+     * @brief Update falling items, putting landed ones to sleep
      * @param deltaTime Time delta
      */
     void updateItems(double deltaTime);
 
     /**
      * @brief Check collisions
+     * @param deltaTime Time delta
      */
-    void checkCollisions();
+    void checkCollisions(double deltaTime);
 
     /**
-     * @brief Check player-platform collision
+     * @brief Resolve player-platform contacts in one pass over the platforms around the player
+     * 
+     * Pushes the player out of penetrated platforms and finds the supporting platform, which
+     * sets the ground state and terrain. The platform stood on last tick is checked first and
+     * stays the support while the player is still on it. When nothing is penetrated, the box is
+     * swept from its previous position so a long step cannot carry it through a thin platform.
      * @param player The player
      */
     void checkPlayerPlatformCollision(std::shared_ptr<Player> player);
 
     /**
      * @brief Check projectile-player collision
+     * 
+     * Each projectile sweeps its circle along the path it moved this tick, so fast projectiles
+     * cannot skip a player between two ticks; the nearest player along the path is hit.
+     * Targets are found in parallel against the hot state at the start of the phase; damage is
+     * applied in projectile order, and a projectile whose target was killed by an earlier one
+     * looks again, as it would have serially.
+     * @param deltaTime Time delta
      */
-    void checkProjectilePlayerCollision();
+    void checkProjectilePlayerCollision(double deltaTime);
 
     /**
-     * @brief Check projectile-platform collision
+     * @brief Find the player a projectile hits this tick
+     * @param index Projectile pool index
+     * @param deltaTime Time delta
+     * @return std::int32_t Nearest targetable player along the path (-1: none)
      */
-    void checkProjectilePlatformCollision();
+    std::int32_t findProjectileTarget(std::size_t index, double deltaTime) const;
 
     /**
      * @brief Check player-item collision
@@ -194,19 +508,19 @@ private:
     bool checkCircleRectCollision(const Vector2D& circlePos, double radius,
                                  const Vector2D& rectPos, const Vector2D& rectSize);
 
-    /**
-     * @brief Get the terrain type where player is standing
-     * @param player The player
-     * @return TerrainType Terrain type
-     */
-    TerrainType getPlayerTerrainType(std::shared_ptr<Player> player);
-
     /**
      * @brief Generate random item type
      * @return ItemType Item type
      */
     ItemType generateRandomItemType();
 
+    /**
+     * @brief Get the spawn position of a player
+     * @param index Player index
+     * @return Vector2D Spawn position
+     */
+    Vector2D getSpawnPosition(int index) const;
+
     /**
      * @brief Generate random drop position
      * @return Vector2D Drop position
@@ -215,19 +529,39 @@ private:
 
 private:
     GameState m_gameState;                                    ///< Game state
-    std::shared_ptr<Player> m_player1;                       ///< Player 1
-    std::shared_ptr<Player> m_player2;                       ///< Player 2
-    std::vector<std::shared_ptr<Projectile>> m_projectiles; ///< Projectile list
-    std::vector<std::shared_ptr<Item>> m_items;             ///< Item list
-    std::vector<Platform> m_platforms;                       ///< Platform list
+    EntityWorld m_world;                                      ///< Players, projectiles and items
+    TimerWheel m_timers;                                      ///< Item drops, expiries, cooldowns and effects
+    double m_timerRemainder;                                  ///< Fraction of a millisecond not yet passed to m_timers
+    std::vector<std::shared_ptr<Player>> m_players;          ///< Players
+    PlayerHotState m_playerHot;                               ///< Collision state of all players
+    int m_playerCount;                                        ///< Players created by initialize()
+    int m_teamCount;                                          ///< Teams created by initialize()
+    Level m_level;                                            ///< Loaded level
+    ChunkStreamer m_streamer;                                 ///< Resident chunks of the level
+    std::vector<StreamRegion> m_streamRegions;                ///< Scratch list of regions to keep resident
+    StreamRegion m_viewRegion;                                ///< Region shown on screen
+    bool m_hasViewRegion;                                     ///< Whether m_viewRegion was set
+    std::vector<Platform> m_platforms;                       ///< Platforms of resident chunks
     int m_winner;                                             ///< Winner
-
-    // Random number generator
-    std::random_device m_randomDevice;                       ///< Random device
-    std::mt19937 m_randomGenerator;                          ///< Random number generator
-
-    // Item drop timer
-    QTimer* m_itemDropTimer;                                 ///< Item drop timer
+    BalanceConfig m_balance;                                  ///< Balance parameters used by players and items
+
+    // Input
+    InputQueue m_inputQueue;                                  ///< Pending input events
+    KeyBindings m_keyBindings;                                ///< Key to player action table
+    std::vector<ActionMask> m_heldActions;                    ///< Currently held actions per player
+    std::vector<std::unique_ptr<BotController>> m_bots;       ///< Bot per player index (null when not bot-driven)
+    LatencyTracker* m_latencyTracker;                         ///< Input latency tracker (optional)
+
+    // Random streams
+    RandomStream m_lootRandom;                               ///< Item types of drops
+    RandomStream m_dropRandom;                               ///< Drop positions
+    TimerHandle m_itemDropTimer;                             ///< Timer of the next item drop
+
+    // Parallel update
+    std::unique_ptr<JobSystem> m_jobs;                       ///< Runs tick phases and their chunks
+    std::size_t m_entityCapacity;                            ///< Entities reserved for a round
+    std::vector<std::vector<Entity>> m_chunkRemovals;        ///< Projectiles to destroy, per chunk
+    std::vector<std::vector<std::pair<std::size_t, std::int32_t>>> m_chunkHits; ///< Projectile index and target, per chunk
 };
 
 #endif // GAMEENGINE_H 
\ No newline at end of file
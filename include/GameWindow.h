@@ -10,6 +10,9 @@
 
 #include "GameEngine.h"
 #include "GameConfig.h"
+#include "FramePacer.h"
+#include "LatencyTracker.h"
+#include "AllocationTracker.h"
 #include <QMainWindow>
 #include <QPainter>
 #include <QTimer>
@@ -21,6 +24,14 @@
 #include <chrono>
 #include <set>
 
+/**
+ * @brief Per-frame render culling counters
+ */
+struct RenderStats {
+    int drawn;   ///< Platforms, players and entities submitted to the painter
+    int culled;  ///< Platforms, players and entities skipped as off-screen
+};
+
 /**
  * @brief Game main window class
  * 
@@ -41,6 +52,35 @@ public:
      */
     ~GameWindow();
 
+    /**
+     * @brief Export input latency session statistics
+     * @param path Output CSV file path
+     * @return bool Whether the file was written
+     */
+    bool exportLatencyStatistics(const QString& path) const;
+
+    /**
+     * @brief Export per-frame heap allocation counts of the last frames
+     * @param path Output CSV file path
+     * @return bool Whether the file was written
+     */
+    bool exportAllocationTrace(const QString& path) const;
+
+    /**
+     * @brief Load a baked level file and restart the round on it
+     * @param path Level file path
+     * @param error Receives a message on failure (optional)
+     * @return bool Whether the level was loaded
+     */
+    bool loadLevel(const QString& path, QString* error = nullptr);
+
+    /**
+     * @brief Let a bot drive a player
+     * @param playerIndex Player index
+     * @param type Bot type
+     */
+    void setBot(int playerIndex, BotType type);
+
 protected:
     /**
      * @brief Paint event
@@ -69,8 +109,9 @@ protected:
 private slots:
     /**
      * @brief Game loop update
+     * @param deltaTime Time since previous frame in seconds
      */
-    void gameLoop();
+    void gameLoop(double deltaTime);
 
 private:
     /**
@@ -78,6 +119,21 @@ private:
      */
     void initializeUI();
 
+    /**
+     * @brief Move the camera towards the players
+     * @param deltaTime Time since previous frame in seconds
+     * @param snap Jump to the target instead of easing towards it
+     */
+    void updateCamera(double deltaTime, bool snap = false);
+
+    /**
+     * @brief Check if a world-space box overlaps the view
+     * @param min Box minimum corner
+     * @param max Box maximum corner
+     * @return bool Whether the box is at least partly on screen
+     */
+    bool isOnScreen(const Vector2D& min, const Vector2D& max) const;
+
     /**
      * @brief Draw game elements
      * @param painter Painter object
@@ -91,7 +147,7 @@ private:
     void drawBackground(QPainter* painter);
 
     /**
-     * @brief Draw platforms
+     * @brief Draw platforms in the view, found through the level collision grid
      * @param painter Painter object
      */
     void drawPlatforms(QPainter* painter);
@@ -110,16 +166,10 @@ private:
     void drawPlayer(QPainter* painter, std::shared_ptr<Player> player);
 
     /**
-     * @brief Draw projectiles
+     * @brief Draw all sprite entities (projectiles and items)
      * @param painter Painter object
      */
-    void drawProjectiles(QPainter* painter);
-
-    /**
-     * @brief Draw items
-     * @param painter Painter object
-     */
-    void drawItems(QPainter* painter);
+    void drawEntities(QPainter* painter);
 
     /**
      * @brief Draw UI interface
@@ -159,6 +209,18 @@ private:
      */
     void drawFPS(QPainter* painter);
 
+    /**
+     * @brief Draw live input latency histogram
+     * @param painter Painter object
+     */
+    void drawLatencyOverlay(QPainter* painter);
+
+    /**
+     * @brief Draw heap allocations of the last frame per phase
+     * @param painter Painter object
+     */
+    void drawAllocationOverlay(QPainter* painter);
+
     /**
      * @brief Update FPS calculation
      */
@@ -180,14 +242,26 @@ private:
 
 private:
     std::unique_ptr<GameEngine> m_gameEngine; ///< Game engine
-    QTimer* m_gameTimer;                      ///< Game loop timer
+    FramePacer* m_framePacer;                 ///< Game loop frame pacer
+    Vector2D m_camera;                        ///< Top-left corner of the view in world coordinates
+    
+    // Render culling
+    RenderStats m_renderStats;                ///< Culling counters of the last frame
+    std::vector<std::uint32_t> m_visiblePlatforms; ///< Scratch list of platforms in the view
     
     // FPS calculation
-    std::chrono::high_resolution_clock::time_point m_lastFrameTime; ///< Last frame time
     int m_frameCount;                         ///< Frame count
     double m_currentFPS;                      ///< Current FPS
     std::chrono::high_resolution_clock::time_point m_fpsUpdateTime; ///< FPS update time
 
+    // Input latency measurement
+    LatencyTracker m_latencyTracker;          ///< Input-to-photon latency tracker
+    bool m_showLatencyOverlay;                ///< Whether the latency histogram is shown
+
+    // Heap allocation tracking
+    AllocationTrace m_allocationTrace;        ///< Per-frame allocation counts
+    bool m_showAllocationOverlay;             ///< Whether the allocation counts are shown
+
     // UI elements
     QWidget* m_centralWidget;                 ///< Central widget
     
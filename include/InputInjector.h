@@ -0,0 +1,71 @@
+/**
+ * @file InputInjector.h
+ * @brief Synthetic input injector class definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef INPUTINJECTOR_H
+#define INPUTINJECTOR_H
+
+#include <QObject>
+#include <QTimer>
+#include <random>
+
+class QWidget;
+
+/**
+ * @brief Synthetic input injector
+ * 
+ * Posts key press/release pairs for player controls to a target widget at jittered intervals,
+ * so input latency can be measured without a human, e.g. with the offscreen platform plugin.
+ */
+class InputInjector : public QObject {
+    Q_OBJECT
+
+public:
+    /**
+     * @brief Constructor
+     * @param target Widget receiving the key events
+     * @param pressCount Number of key presses to inject
+     * @param intervalMs Base interval between presses in milliseconds
+     * @param parent Parent object
+     */
+    InputInjector(QWidget* target, int pressCount, int intervalMs, QObject* parent = nullptr);
+
+    /**
+     * @brief Start injecting
+     */
+    void start();
+
+signals:
+    /**
+     * @brief Emitted after the last key has been released
+     */
+    void finished();
+
+private slots:
+    /**
+     * @brief Inject the next key event
+     */
+    void injectNext();
+
+private:
+    /**
+     * @brief Post a key event to the target
+     * @param key Key code
+     * @param pressed Whether this is a press or a release
+     */
+    void postKey(int key, bool pressed);
+
+private:
+    QWidget* m_target;              ///< Event receiver
+    QTimer* m_timer;                ///< Injection timer
+    int m_pressCount;               ///< Total presses to inject
+    int m_injected;                 ///< Presses injected so far
+    int m_intervalMs;               ///< Base injection interval
+    int m_heldKey;                  ///< Currently held key (0 if none)
+    std::mt19937 m_randomGenerator; ///< Interval jitter generator
+};
+
+#endif // INPUTINJECTOR_H
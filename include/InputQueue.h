@@ -0,0 +1,136 @@
+/**
+ * @file InputQueue.h
+ * @brief Input event queue and key binding table definitions
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef INPUTQUEUE_H
+#define INPUTQUEUE_H
+
+#include <Qt>
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Per-player action bitmask
+ */
+using ActionMask = std::uint8_t;
+
+/**
+ * @brief Player action bits
+ */
+namespace Action {
+    constexpr ActionMask NONE = 0;         ///< No action
+    constexpr ActionMask LEFT = 1 << 0;    ///< Move left
+    constexpr ActionMask RIGHT = 1 << 1;   ///< Move right
+    constexpr ActionMask JUMP = 1 << 2;    ///< Jump
+    constexpr ActionMask CROUCH = 1 << 3;  ///< Crouch/pickup
+    constexpr ActionMask FIRE = 1 << 4;    ///< Attack/fire
+}
+
+/**
+ * @brief Captured input event
+ */
+struct InputEvent {
+    long long timestamp;  ///< Capture time (steady clock nanoseconds)
+    Qt::Key key;          ///< Key code
+    bool pressed;         ///< true for press, false for release
+};
+
+/**
+ * @brief Fixed-capacity input event ring buffer
+ * 
+ * Events are pushed from the window's key handlers and drained by the engine at the start
+ * of each tick, so input is always applied at a tick boundary in arrival order.
+ */
+class InputQueue {
+public:
+    static constexpr int CAPACITY = 256; ///< Ring buffer capacity (power of two)
+
+    /**
+     * @brief Constructor
+     */
+    InputQueue();
+
+    /**
+     * @brief Append an event
+     * @param event The event
+     * @return bool Whether the event was stored (false when full)
+     */
+    bool push(const InputEvent& event);
+
+    /**
+     * @brief Remove the oldest event
+     * @param event Receives the event
+     * @return bool Whether an event was available
+     */
+    bool pop(InputEvent& event);
+
+    /**
+     * @brief Discard all queued events
+     */
+    void clear();
+
+    // Getter methods
+    bool isEmpty() const { return m_head == m_tail; }
+    int size() const { return static_cast<int>(m_tail - m_head); }
+    long long getDroppedCount() const { return m_dropped; }
+
+private:
+    std::array<InputEvent, CAPACITY> m_events; ///< Event storage
+    unsigned int m_head;                       ///< Read counter
+    unsigned int m_tail;                       ///< Write counter
+    long long m_dropped;                       ///< Events rejected because the queue was full
+};
+
+/**
+ * @brief Precomputed key to player action lookup table
+ * 
+ * Maps a Qt key to the player it controls and the action bit it drives in O(1).
+ */
+class KeyBindings {
+public:
+    /**
+     * @brief Binding table entry
+     */
+    struct Binding {
+        int key;            ///< Bound key code (-1 when the slot is empty)
+        int playerIndex;    ///< Controlled player index
+        ActionMask action;  ///< Action bit
+    };
+
+    /**
+     * @brief Constructor, builds the table from GameConfig key mapping
+     */
+    KeyBindings();
+
+    /**
+     * @brief Bind a key to a player action
+     * @param key Key code
+     * @param playerIndex Player index
+     * @param action Action bit
+     */
+    void bind(Qt::Key key, int playerIndex, ActionMask action);
+
+    /**
+     * @brief Look up a key
+     * @param key Key code
+     * @return const Binding* Binding, or nullptr if the key is unbound
+     */
+    const Binding* lookup(Qt::Key key) const;
+
+private:
+    /**
+     * @brief Compute table slot for a key
+     * @param key Key code
+     * @return int Slot index
+     */
+    static int slotFor(int key);
+
+private:
+    static constexpr int TABLE_SIZE = 256;     ///< Number of table slots
+    std::array<Binding, TABLE_SIZE> m_table;   ///< Lookup table
+};
+
+#endif // INPUTQUEUE_H
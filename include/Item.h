@@ -1,6 +1,6 @@
 /**
  * @file Item.h
- * @brief Item system class definitions
+ * @brief Item system definitions
  * @author Justin0828
  * @date 2025-07-23
  */
@@ -8,10 +8,8 @@
 #ifndef ITEM_H
 #define ITEM_H
 
-#include "Vector2D.h"
-#include "Weapon.h"
-#include <memory>
-#include <QColor>
+// Forward declaration
+class Player;
 
 /**
  * @brief Item type enumeration
@@ -27,150 +25,45 @@ enum class ItemType {
 };
 
 /**
- * @brief Item base class
+ * @brief Static per-type item parameters
  */
-class Item {
-public:
-    /**
-     * @brief Constructor
-     * @param type Item type
-     * @param position Position
-     */
-    Item(ItemType type, const Vector2D& position);
-
-    /**
-     * @brief Virtual destructor
-     */
-    virtual ~Item() = default;
-
-    /**
-     * @brief Update item state
-     * @param deltaTime Time delta
-     */
-    virtual void update(double deltaTime);
-
-    /**
-     * @brief Effect when picked up by player
-     * @param player The player who picked up
-     * @return bool Whether pickup was successful
-     */
-    virtual bool onPickup(Player* player) = 0;
-
-    /**
-     * @brief Check if item is still valid
-     * @return bool Whether valid
-     */
-    bool isValid() const;
-
-    // Getter methods
-    ItemType getType() const { return m_type; }
-    Vector2D getPosition() const { return m_position; }
-    Vector2D getVelocity() const { return m_velocity; }
-    double getWidth() const { return m_width; }
-    double getHeight() const { return m_height; }
-    QColor getColor() const { return m_color; }
-    bool isGrounded() const { return m_isGrounded; }
-
-    // Setter methods
-    void setPosition(const Vector2D& pos) { m_position = pos; }
-    void setVelocity(const Vector2D& vel) { m_velocity = vel; }
-    void setGrounded(bool grounded) { m_isGrounded = grounded; }
-
-protected:
-    ItemType m_type;           ///< Item type
-    Vector2D m_position;       ///< Position
-    Vector2D m_velocity;       ///< Velocity
-    double m_width;            ///< Width
-    double m_height;           ///< Height
-    QColor m_color;            ///< Color
-    bool m_isGrounded;         ///< Whether on ground
-    bool m_isValid;            ///< Whether valid
-    long long m_spawnTime;     ///< Spawn time
-    static constexpr long long ITEM_LIFETIME = 30000; ///< Item lifetime in milliseconds
+struct ItemSpec {
+    double width;        ///< Width
+    double height;       ///< Height
+    unsigned int color;  ///< Color (0xRRGGBB)
+    char label;          ///< Label drawn on the item
 };
 
 /**
- * @brief Weapon item class
+ * @brief Item parameter table, indexed by ItemType
  */
-class WeaponItem : public Item {
-public:
-    /**
-     * @brief Constructor
-     * @param type Weapon type
-     * @param position Position
-     */
-    WeaponItem(ItemType type, const Vector2D& position);
-
-    /**
-     * @brief Create weapon when picked up
-     * @param player The player who picked up
-     * @return bool Whether pickup was successful
-     */
-    bool onPickup(Player* player) override;
-
-private:
-    /**
-     * @brief Create corresponding weapon
-     * @return std::shared_ptr<Weapon> Weapon object
-     */
-    std::shared_ptr<Weapon> createWeapon();
+constexpr ItemSpec ITEM_SPECS[] = {
+    {25, 8, 0xC0C0C0, 'K'},     // WEAPON_KNIFE, silver
+    {16, 16, 0xFFA500, 'B'},    // WEAPON_BALL, orange
+    {40, 12, 0x808080, 'R'},    // WEAPON_RIFLE, gray
+    {50, 15, 0x404040, 'S'},    // WEAPON_SNIPER, dark gray
+    {20, 15, 0xFFFFFF, '+'},    // BANDAGE, white
+    {25, 20, 0xFF0000, 'H'},    // MEDKIT, red
+    {15, 25, 0x00FF00, 'A'}     // ADRENALINE, green
 };
 
-/**
- * @brief Bandage item class
- */
-class BandageItem : public Item {
-public:
-    /**
-     * @brief Constructor
-     * @param position Position
-     */
-    explicit BandageItem(const Vector2D& position);
-
-    /**
-     * @brief Restore small amount of health when picked up
-     * @param player The player who picked up
-     * @return bool Whether pickup was successful
-     */
-    bool onPickup(Player* player) override;
-};
+constexpr int ITEM_TYPE_COUNT = sizeof(ITEM_SPECS) / sizeof(ITEM_SPECS[0]); ///< Number of item types
 
 /**
- * @brief Medical kit item class
+ * @brief Look up item parameters
+ * @param type Item type
+ * @return const ItemSpec& Parameters
  */
-class MedkitItem : public Item {
-public:
-    /**
-     * @brief Constructor
-     * @param position Position
-     */
-    explicit MedkitItem(const Vector2D& position);
-
-    /**
-     * @brief Restore full health when picked up
-     * @param player The player who picked up
-     * @return bool Whether pickup was successful
-     */
-    bool onPickup(Player* player) override;
-};
+constexpr const ItemSpec& getItemSpec(ItemType type) {
+    return ITEM_SPECS[static_cast<int>(type)];
+}
 
 /**
- * @brief Adrenaline item class
+ * @brief Apply the effect of picking up an item
+ * @param type Item type
+ * @param player The player who picked up
+ * @return bool Whether pickup was successful (the item is consumed)
  */
-class AdrenalineItem : public Item {
-public:
-    /**
-     * @brief Constructor
-     * @param position Position
-     */
-    explicit AdrenalineItem(const Vector2D& position);
-
-    /**
-     * @brief Apply adrenaline effect when picked up
-     * @param player The player who picked up
-     * @return bool Whether pickup was successful
-     */
-    bool onPickup(Player* player) override;
-};
+bool applyItemPickup(ItemType type, Player* player);
 
-#endif // ITEM_H 
\ No newline at end of file
+#endif // ITEM_H
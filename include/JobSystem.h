@@ -0,0 +1,132 @@
+/**
+ * @file JobSystem.h
+ * @brief Job system definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include "AllocationTracker.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Runs chunks of data-parallel loops on persistent helper threads
+ *
+ * parallelFor() splits an index range into at most getThreadCount() contiguous chunks. The
+ * calling thread runs the first chunk and then helps with queued chunks until all are done,
+ * so jobs may themselves call parallelFor() without deadlocking. The chunk boundaries depend
+ * only on the count, the grain and the thread count, never on scheduling: results collected
+ * per chunk and merged in chunk order are the same on every run.
+ */
+class JobSystem {
+public:
+    /**
+     * @brief Constructor, starts the helper threads
+     * @param threads Threads running chunks, including the caller (0: one per core)
+     */
+    explicit JobSystem(int threads = 0);
+
+    /**
+     * @brief Destructor, stops the helper threads
+     */
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Number of chunks parallelFor() uses for a range
+     * @param count Range length
+     * @param grain Minimum indices per chunk
+     * @return std::size_t Chunk count (0 for an empty range)
+     */
+    std::size_t getChunkCount(std::size_t count, std::size_t grain) const {
+        if (count == 0) return 0;
+        std::size_t byGrain = (count + std::max<std::size_t>(grain, 1) - 1) / std::max<std::size_t>(grain, 1);
+        return std::min(byGrain, static_cast<std::size_t>(m_threadCount));
+    }
+
+    /**
+     * @brief Run a job over contiguous chunks of [0, count) and wait for all of them
+     * @param count Range length
+     * @param grain Minimum indices per chunk; small ranges run on the calling thread only
+     * @param job Called as job(chunk, begin, end) once per chunk
+     */
+    template<typename Job>
+    void parallelFor(std::size_t count, std::size_t grain, Job&& job) {
+        std::size_t chunks = getChunkCount(count, grain);
+        if (chunks <= 1) {
+            if (chunks == 1) job(std::size_t(0), std::size_t(0), count);
+            return;
+        }
+        run(count, chunks, &invoke<std::remove_reference_t<Job>>, const_cast<void*>(static_cast<const void*>(&job)));
+    }
+
+    // Getter methods
+    int getThreadCount() const { return m_threadCount; }
+
+private:
+    /**
+     * @brief Type-erased job entry point
+     */
+    using JobFunction = void (*)(void* job, std::size_t chunk, std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Call a job of a known type
+     */
+    template<typename Job>
+    static void invoke(void* job, std::size_t chunk, std::size_t begin, std::size_t end) {
+        (*static_cast<Job*>(job))(chunk, begin, end);
+    }
+
+    /**
+     * @brief One queued chunk
+     */
+    struct Task {
+        JobFunction function;   ///< Job entry point
+        void* job;              ///< Job object
+        std::size_t chunk;      ///< Chunk index
+        std::size_t begin;      ///< First index
+        std::size_t end;        ///< One past the last index
+        int* remaining;         ///< Unfinished chunks of the parallelFor() call
+        AllocationPhase phase;  ///< Allocation phase of the calling thread
+    };
+
+    /**
+     * @brief Queue chunks 1..chunks-1, run chunk 0 and help until the call is complete
+     * @param count Range length
+     * @param chunks Chunk count (at least 2)
+     * @param function Job entry point
+     * @param job Job object
+     */
+    void run(std::size_t count, std::size_t chunks, JobFunction function, void* job);
+
+    /**
+     * @brief Run a task and report its completion
+     * @param task The task (already removed from the queue)
+     */
+    void execute(const Task& task);
+
+    /**
+     * @brief Thread loop: run queued tasks until stopped
+     */
+    void workerLoop();
+
+private:
+    int m_threadCount;                   ///< Threads running chunks, including callers
+    std::vector<std::thread> m_threads;  ///< Helper threads
+    std::mutex m_mutex;                  ///< Guards the fields below
+    std::condition_variable m_wake;      ///< Signals queued tasks, finished calls and stopping
+    std::vector<Task> m_queue;           ///< Queued tasks (capacity is kept, so queuing does not allocate)
+    bool m_stopping;                     ///< Set to end the threads
+};
+
+#endif // JOBSYSTEM_H
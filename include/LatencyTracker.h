@@ -0,0 +1,101 @@
+/**
+ * @file LatencyTracker.h
+ * @brief Input-to-photon latency tracker class definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef LATENCYTRACKER_H
+#define LATENCYTRACKER_H
+
+#include <QString>
+#include <array>
+
+/**
+ * @brief Input-to-photon latency tracker
+ * 
+ * Follows each input event from its capture in the key handler, through the engine tick
+ * that consumes it, to the first paint event that reflects it. Latencies are accumulated
+ * into a fixed-bucket histogram from which session statistics are derived.
+ */
+class LatencyTracker {
+public:
+    static constexpr int BUCKET_COUNT = 100;         ///< Number of regular histogram buckets
+    static constexpr double BUCKET_WIDTH_MS = 0.5;   ///< Histogram bucket width in milliseconds
+    static constexpr int PENDING_CAPACITY = 64;      ///< Consumed events awaiting presentation
+
+    /**
+     * @brief Constructor
+     */
+    LatencyTracker();
+
+    /**
+     * @brief Get current monotonic timestamp
+     * @return long long Steady clock time in nanoseconds
+     */
+    static long long now();
+
+    /**
+     * @brief Record that an input event was consumed by an engine tick
+     * @param inputTimestamp Capture time of the input event (nanoseconds)
+     * @param tickTimestamp Time the consuming tick started (nanoseconds)
+     */
+    void recordConsumed(long long inputTimestamp, long long tickTimestamp);
+
+    /**
+     * @brief Record a presented frame, completing all consumed events
+     * @param presentTimestamp Time the frame finished painting (nanoseconds)
+     */
+    void recordPresented(long long presentTimestamp);
+
+    /**
+     * @brief Clear all samples
+     */
+    void reset();
+
+    /**
+     * @brief Get latency percentile estimated from the histogram
+     *
+     * Reports the upper edge of the bucket holding the percentile; percentiles in the
+     * overflow bucket report the maximum.
+     * @param percentile Percentile in [0, 100]
+     * @return double Latency in milliseconds
+     */
+    double getPercentile(double percentile) const;
+
+    /**
+     * @brief Export session statistics and histogram as CSV
+     * @param path Output file path
+     * @return bool Whether the file was written
+     */
+    bool exportStatistics(const QString& path) const;
+
+    // Getter methods
+    long long getSampleCount() const { return m_sampleCount; }
+    double getMean() const { return m_sampleCount > 0 ? m_totalSum / m_sampleCount : 0.0; }
+    double getMin() const { return m_sampleCount > 0 ? m_min : 0.0; }
+    double getMax() const { return m_max; }
+    double getMeanQueueDelay() const { return m_sampleCount > 0 ? m_queueSum / m_sampleCount : 0.0; }
+    const std::array<long long, BUCKET_COUNT + 1>& getHistogram() const { return m_histogram; }
+
+private:
+    /**
+     * @brief Consumed event awaiting presentation
+     */
+    struct PendingEvent {
+        long long inputTimestamp; ///< Capture time (nanoseconds)
+        long long tickTimestamp;  ///< Consumption time (nanoseconds)
+    };
+
+    std::array<PendingEvent, PENDING_CAPACITY> m_pending; ///< Consumed, not yet presented events
+    int m_pendingCount;                                   ///< Number of pending events
+
+    std::array<long long, BUCKET_COUNT + 1> m_histogram;  ///< Latency histogram (last bucket is overflow)
+    long long m_sampleCount;   ///< Number of completed samples
+    double m_totalSum;         ///< Sum of input-to-photon latencies (ms)
+    double m_queueSum;         ///< Sum of input-to-tick latencies (ms)
+    double m_min;              ///< Minimum latency (ms)
+    double m_max;              ///< Maximum latency (ms)
+};
+
+#endif // LATENCYTRACKER_H
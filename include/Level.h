@@ -0,0 +1,110 @@
+/**
+ * @file Level.h
+ * @brief Level class definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include "LevelFormat.h"
+#include <memory>
+#include <vector>
+#include <QString>
+
+class QFile;
+
+/**
+ * @brief Loaded level
+ *
+ * Gives read-only access to a binary level. Files are memory-mapped and used in place;
+ * the built-in arena is baked into an owned buffer with the same layout. Which chunks take
+ * part in the simulation is decided by ChunkStreamer.
+ */
+class Level {
+public:
+    /**
+     * @brief Constructor, loads the built-in arena
+     */
+    Level();
+
+    /**
+     * @brief Destructor
+     */
+    ~Level();
+
+    Level(const Level&) = delete;
+    Level& operator=(const Level&) = delete;
+
+    /**
+     * @brief Load a baked level file
+     *
+     * On failure the previously loaded level is kept.
+     * @param path Level file path
+     * @param error Receives a message on failure (optional)
+     * @return bool Whether the file was loaded
+     */
+    bool load(const QString& path, QString* error = nullptr);
+
+    /**
+     * @brief Load the built-in arena
+     */
+    void loadBuiltin();
+
+    // Getter methods
+    const LevelFormat::Header& getHeader() const { return *m_header; }
+    double getWorldWidth() const { return m_header->worldWidth; }
+    double getWorldHeight() const { return m_header->worldHeight; }
+    std::uint32_t getPlatformCount() const { return m_header->platformCount; }
+    const LevelFormat::PlatformRecord& getPlatform(std::uint32_t index) const { return m_platforms[index]; }
+    std::uint32_t getSpawnCount() const { return m_header->spawnCount; }
+    const LevelFormat::SpawnRecord& getSpawn(std::uint32_t index) const { return m_spawns[index]; }
+    double getChunkSize() const { return m_header->chunkSize; }
+    std::uint32_t getChunkColumns() const { return m_header->chunkColumns; }
+    std::uint32_t getChunkRows() const { return m_header->chunkRows; }
+    std::uint32_t getCellsPerChunk() const { return m_header->cellsPerChunk; }
+    const LevelFormat::ChunkRecord& getChunk(std::uint32_t chunk) const { return m_chunks[chunk]; }
+    const LevelFormat::GridCell* getChunkCells(std::uint32_t chunk) const {
+        return m_cells + static_cast<std::size_t>(chunk) * m_header->cellsPerChunk * m_header->cellsPerChunk;
+    }
+    std::uint32_t getIndex(std::uint32_t position) const { return m_indices[position]; }
+    std::uint32_t getColumnsPerChunk() const { return m_header->columnsPerChunk; }
+    const LevelFormat::SurfaceColumn* getChunkSurfaceColumns(std::uint32_t chunk) const {
+        return m_columns + static_cast<std::size_t>(chunk) * m_header->columnsPerChunk;
+    }
+    const LevelFormat::SurfaceRecord& getSurface(std::uint32_t position) const { return m_surfaces[position]; }
+
+    /**
+     * @brief Check that a chunk only references valid index, surface and platform ranges
+     * 
+     * Done per chunk when it is paged in, so loading never touches the whole file.
+     * @param chunk Chunk index
+     * @return bool Whether the chunk can be used
+     */
+    bool isChunkValid(std::uint32_t chunk) const;
+
+private:
+    /**
+     * @brief Validate a level image and point the section pointers into it
+     * @param data Level image
+     * @param size Image size in bytes
+     * @param error Receives a message on failure
+     * @return bool Whether the image is valid
+     */
+    bool bind(const unsigned char* data, std::size_t size, QString& error);
+
+private:
+    std::unique_ptr<QFile> m_file;                   ///< Mapped level file (null for the built-in arena)
+    std::vector<unsigned char> m_buffer;             ///< Owned image of the built-in arena
+    const LevelFormat::Header* m_header;             ///< Header
+    const LevelFormat::PlatformRecord* m_platforms;  ///< Platform records
+    const LevelFormat::SpawnRecord* m_spawns;        ///< Spawn records
+    const LevelFormat::ChunkRecord* m_chunks;        ///< Chunk records
+    const LevelFormat::GridCell* m_cells;            ///< Chunk collision grid cells
+    const std::uint32_t* m_indices;                  ///< Platform indices referenced by chunks and cells
+    const LevelFormat::SurfaceColumn* m_columns;     ///< Chunk surface columns
+    const LevelFormat::SurfaceRecord* m_surfaces;    ///< Surface records referenced by columns
+};
+
+#endif // LEVEL_H
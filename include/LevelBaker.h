@@ -0,0 +1,123 @@
+/**
+ * @file LevelBaker.h
+ * @brief Level baker class definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef LEVELBAKER_H
+#define LEVELBAKER_H
+
+#include "LevelFormat.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Level baker
+ * 
+ * Collects platforms and spawn points and serializes them, together with the chunk table,
+ * per-chunk collision grids and per-chunk surface tables, into the binary level format.
+ * 
+ * Text source syntax, one directive per line (lines starting with '#' are comments):
+ *   world <width> <height>
+ *   chunk <size>
+ *   cell <size>
+ *   column <size>
+ *   platform <x> <y> <width> <height> <ground|grass|ice> [#rrggbb]
+ *   spawn <x> <y>
+ */
+class LevelBaker {
+public:
+    /**
+     * @brief Constructor
+     */
+    LevelBaker();
+
+    /**
+     * @brief Set world size
+     * @param width World width
+     * @param height World height
+     */
+    void setWorldSize(float width, float height);
+
+    /**
+     * @brief Set chunk size
+     * @param size Chunk edge length in pixels
+     */
+    void setChunkSize(float size);
+
+    /**
+     * @brief Set collision grid cell size
+     * 
+     * Snapped on bake so that a whole number of cells spans a chunk.
+     * @param size Cell size in pixels
+     */
+    void setCellSize(float size);
+
+    /**
+     * @brief Set surface column width
+     * 
+     * Snapped on bake so that a whole number of columns spans a chunk.
+     * @param size Column width in pixels
+     */
+    void setColumnSize(float size);
+
+    /**
+     * @brief Add a platform
+     * @param record Platform record
+     */
+    void addPlatform(const LevelFormat::PlatformRecord& record);
+
+    /**
+     * @brief Add a spawn point
+     * @param record Spawn record
+     */
+    void addSpawn(const LevelFormat::SpawnRecord& record);
+
+    /**
+     * @brief Parse a text level source
+     * @param source Source text
+     * @param error Receives a message on failure
+     * @return bool Whether the source was valid
+     */
+    bool parseText(const std::string& source, std::string& error);
+
+    /**
+     * @brief Serialize the level
+     *
+     * Fails instead of writing a file Level::bind() would refuse: a chunk grid over the
+     * LevelFormat limits or a file of 4 GiB or more.
+     * @param data Receives the binary level file contents
+     * @param error Receives a message on failure
+     * @return bool Whether the level was serialized
+     */
+    bool bake(std::vector<unsigned char>& data, std::string& error) const;
+
+    /**
+     * @brief Get default color of a terrain
+     * @param terrain Terrain code
+     * @return std::uint32_t Color (0xRRGGBB)
+     */
+    static std::uint32_t defaultTerrainColor(std::uint32_t terrain);
+
+private:
+    /**
+     * @brief Check the chunk grid against the LevelFormat limits
+     * @param error Receives a message on failure
+     * @param chunkLine Source line that last set the world or chunk size (0: none)
+     * @param cellLine Source line that last set the chunk or cell size (0: none)
+     * @param columnLine Source line that last set the chunk or column size (0: none)
+     * @return bool Whether the grid fits
+     */
+    bool checkGrid(std::string& error, int chunkLine = 0, int cellLine = 0, int columnLine = 0) const;
+
+    float m_worldWidth;                                   ///< World width
+    float m_worldHeight;                                  ///< World height
+    float m_chunkSize;                                    ///< Chunk edge length
+    float m_cellSize;                                     ///< Collision grid cell size
+    float m_columnSize;                                   ///< Surface column width
+    std::vector<LevelFormat::PlatformRecord> m_platforms; ///< Platforms
+    std::vector<LevelFormat::SpawnRecord> m_spawns;       ///< Spawn points
+};
+
+#endif // LEVELBAKER_H
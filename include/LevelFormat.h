@@ -0,0 +1,133 @@
+/**
+ * @file LevelFormat.h
+ * @brief Binary level file layout definitions
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef LEVELFORMAT_H
+#define LEVELFORMAT_H
+
+#include <cstdint>
+
+/**
+ * @brief Binary level file layout
+ * 
+ * A level file is a header followed by flat little-endian record arrays at 4-byte aligned
+ * offsets, so a memory-mapped file can be used in place without parsing. Files are produced
+ * from a text source by the qtgame_levelc baker.
+ *
+ * The world is divided into square chunks. Every chunk lists the platforms overlapping it and
+ * owns a small collision grid; all per-chunk data is stored chunk by chunk, so only the pages
+ * of chunks near the players are ever touched.
+ *
+ * Every chunk also owns a surface table: its width is split into narrow columns, each listing
+ * the top edges inside the chunk that span it, sorted by height. Ground, landing and terrain
+ * queries binary search one column instead of testing every platform around a body.
+ */
+namespace LevelFormat {
+    constexpr std::uint32_t MAGIC = 0x564C5451;  ///< "QTLV"
+    constexpr std::uint32_t VERSION = 3;         ///< Current format version
+    constexpr std::uint32_t MAX_CHUNKS_PER_AXIS = 4096;     ///< Most chunk columns or rows a level may have
+    constexpr std::uint32_t MAX_CELLS_PER_CHUNK = 256;      ///< Most grid cells along one chunk edge
+    constexpr std::uint32_t MAX_COLUMNS_PER_CHUNK = 1024;   ///< Most surface columns along one chunk edge
+
+    /**
+     * @brief Terrain codes stored in platform records
+     */
+    enum TerrainCode : std::uint32_t {
+        TERRAIN_GROUND = 0,  ///< Normal ground
+        TERRAIN_GRASS = 1,   ///< Grass
+        TERRAIN_ICE = 2      ///< Ice
+    };
+
+    /**
+     * @brief File header
+     */
+    struct Header {
+        std::uint32_t magic;          ///< MAGIC
+        std::uint32_t version;        ///< VERSION
+        float worldWidth;             ///< World width in pixels
+        float worldHeight;            ///< World height in pixels
+        std::uint32_t platformCount;  ///< Number of platform records
+        std::uint32_t platformOffset; ///< Byte offset of platform records (sorted by chunk)
+        std::uint32_t spawnCount;     ///< Number of spawn records
+        std::uint32_t spawnOffset;    ///< Byte offset of spawn records
+        float chunkSize;              ///< Chunk edge length in pixels
+        std::uint32_t chunkColumns;   ///< Chunk columns
+        std::uint32_t chunkRows;      ///< Chunk rows
+        std::uint32_t chunkOffset;    ///< Byte offset of chunk records (rows * columns)
+        std::uint32_t cellsPerChunk;  ///< Collision grid cells along one chunk edge
+        std::uint32_t gridCellOffset; ///< Byte offset of grid cells (chunk-major)
+        std::uint32_t indexCount;     ///< Number of platform indices referenced by chunks and cells
+        std::uint32_t indexOffset;    ///< Byte offset of platform index array
+        std::uint32_t columnsPerChunk;///< Surface columns along one chunk edge
+        std::uint32_t columnOffset;   ///< Byte offset of surface columns (chunk-major)
+        std::uint32_t surfaceCount;   ///< Number of surface records referenced by columns
+        std::uint32_t surfaceOffset;  ///< Byte offset of surface records
+    };
+
+    /**
+     * @brief Platform record
+     */
+    struct PlatformRecord {
+        float x;                 ///< Left edge
+        float y;                 ///< Top edge
+        float width;             ///< Width
+        float height;            ///< Height
+        std::uint32_t terrain;   ///< TerrainCode
+        std::uint32_t color;     ///< Color (0xRRGGBB)
+    };
+
+    /**
+     * @brief Player spawn point record
+     */
+    struct SpawnRecord {
+        float x;                 ///< Left edge of the player
+        float y;                 ///< Top edge of the player
+    };
+
+    /**
+     * @brief Chunk record, a range in the platform index array
+     */
+    struct ChunkRecord {
+        std::uint32_t first;     ///< First index
+        std::uint32_t count;     ///< Number of platforms overlapping the chunk
+    };
+
+    /**
+     * @brief Collision grid cell, a range in the platform index array
+     */
+    struct GridCell {
+        std::uint32_t first;     ///< First index
+        std::uint32_t count;     ///< Number of indices
+    };
+
+    /**
+     * @brief Surface column, a range in the surface record array
+     */
+    struct SurfaceColumn {
+        std::uint32_t first;     ///< First surface
+        std::uint32_t count;     ///< Number of surfaces (sorted by top, highest first)
+    };
+
+    /**
+     * @brief Top edge of a platform, stored in the chunk containing it
+     */
+    struct SurfaceRecord {
+        float top;               ///< Top edge
+        float left;              ///< Left end
+        float right;             ///< Right end
+        std::uint32_t platform;  ///< Platform index
+    };
+
+    static_assert(sizeof(Header) == 80, "LevelFormat::Header layout changed");
+    static_assert(sizeof(PlatformRecord) == 24, "LevelFormat::PlatformRecord layout changed");
+    static_assert(sizeof(SpawnRecord) == 8, "LevelFormat::SpawnRecord layout changed");
+    static_assert(sizeof(ChunkRecord) == 8, "LevelFormat::ChunkRecord layout changed");
+    static_assert(sizeof(GridCell) == 8, "LevelFormat::GridCell layout changed");
+    static_assert(sizeof(SurfaceColumn) == 8, "LevelFormat::SurfaceColumn layout changed");
+    static_assert(sizeof(SurfaceRecord) == 16, "LevelFormat::SurfaceRecord layout changed");
+}
+
+#endif // LEVELFORMAT_H
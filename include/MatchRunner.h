@@ -0,0 +1,86 @@
+/**
+ * @file MatchRunner.h
+ * @brief Headless bot match runner definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef MATCHRUNNER_H
+#define MATCHRUNNER_H
+
+#include "GameEngine.h"
+#include <vector>
+
+/**
+ * @brief Parameters of a headless match
+ */
+struct MatchSetup {
+    int players = 2;                                    ///< Players
+    int teams = 0;                                      ///< Teams (0: one per player)
+    int maxTicks = 10800;                               ///< Tick limit
+    int tickRate = GameConfig::TARGET_FPS;              ///< Fixed steps per simulated second
+    std::vector<BotType> bots{BotType::AGGRESSIVE};     ///< Bot types, assigned to players round-robin
+    BalanceConfig balance;                              ///< Balance parameters
+    bool checkInvariants = false;                       ///< Whether to check player state every tick
+};
+
+/**
+ * @brief Outcome of a headless match
+ */
+struct MatchResult {
+    int winner;          ///< Winning team index + 1 (0: draw or timeout)
+    bool timedOut;       ///< Whether the tick limit was reached
+    int ticks;           ///< Ticks played
+    int firstKillTick;   ///< Tick of the first death (-1 if nobody died)
+    int violations;      ///< Ticks on which a living player was in an invalid state or passed through a platform
+};
+
+/**
+ * @brief Plays bot-only matches on a private engine at fixed time steps
+ *
+ * Results depend only on the setup, the seed and the match index, so matches can be spread over threads
+ * with one runner per thread.
+ */
+class MatchRunner {
+public:
+    /**
+     * @brief Constructor
+     */
+    MatchRunner();
+
+    /**
+     * @brief Load a baked level file for all following matches
+     * @param path Level file path
+     * @param error Receives a message on failure (optional)
+     * @return bool Whether the level was loaded
+     */
+    bool loadLevel(const QString& path, QString* error = nullptr);
+
+    /**
+     * @brief Play one match to the end or the tick limit
+     * @param setup Match parameters
+     * @param seed Random seed for item drops and bots
+     * @param match Match index, selecting independent random streams of the seed
+     * @return MatchResult Outcome
+     */
+    MatchResult run(const MatchSetup& setup, unsigned int seed, std::uint64_t match = 0);
+
+    // Getter methods
+    const GameEngine& getEngine() const { return m_engine; }
+
+private:
+    /**
+     * @brief Check that all living players are in a sane state
+     *
+     * Besides the state of each player, the step since the previous tick must not have carried
+     * a player from one side of a platform to the other.
+     * @return bool Whether every invariant holds
+     */
+    bool checkInvariants() const;
+
+private:
+    GameEngine m_engine;                       ///< Engine the matches run on
+    std::vector<Vector2D> m_previousPositions; ///< Player positions after the previous tick
+};
+
+#endif // MATCHRUNNER_H
@@ -0,0 +1,113 @@
+/**
+ * @file PixelRenderer.h
+ * @brief Low-resolution integer rasterizer definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef PIXELRENDERER_H
+#define PIXELRENDERER_H
+
+#include "Vector2D.h"
+#include <cstdint>
+#include <vector>
+
+class GameEngine;
+
+/**
+ * @brief Pixel buffer format
+ */
+enum class PixelFormat {
+    GRAY8,      ///< One byte per pixel, luma
+    RGB888      ///< Three bytes per pixel, R G B
+};
+
+/**
+ * @brief Renders the world straight into a small byte buffer
+ *
+ * Meant for pixel observations of training agents, where going through QPainter at window
+ * size and downsampling is far too slow. Draws the same layers as GameWindow (sky gradient,
+ * platforms, players with their weapons, projectiles and items) with integer arithmetic
+ * only; outlines, text and the eye indicator are left out. Every object covers at least one
+ * pixel, so thin platforms and bullets stay visible at low resolution.
+ *
+ * render() does not modify the renderer, so one instance can serve several threads.
+ */
+class PixelRenderer {
+public:
+    /**
+     * @brief Constructor
+     * @param width Target width in pixels
+     * @param height Target height in pixels
+     * @param format Pixel format
+     */
+    PixelRenderer(int width, int height, PixelFormat format);
+
+    /**
+     * @brief Render a view of the world
+     * @param engine The engine
+     * @param viewOrigin World position shown at the top left corner
+     * @param viewSize World size of the view (scaled to the target size)
+     * @param pixels Receives getFrameSize() bytes, rows top to bottom
+     */
+    void render(const GameEngine& engine, const Vector2D& viewOrigin, const Vector2D& viewSize,
+                std::uint8_t* pixels) const;
+
+    /**
+     * @brief Get the view origin centered on a player and clamped to the world
+     * @param engine The engine
+     * @param playerIndex Player index
+     * @param viewSize World size of the view
+     * @return Vector2D View origin
+     */
+    static Vector2D followPlayer(const GameEngine& engine, int playerIndex, const Vector2D& viewSize);
+
+    // Getter methods
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    int getChannels() const { return m_channels; }
+    std::size_t getFrameSize() const { return m_background.size(); }
+
+private:
+    /**
+     * @brief Integer mapping from world to pixel coordinates
+     */
+    struct ViewTransform {
+        int originX;    ///< View origin x (world pixels)
+        int originY;    ///< View origin y (world pixels)
+        int viewWidth;  ///< View width (world pixels)
+        int viewHeight; ///< View height (world pixels)
+    };
+
+    /**
+     * @brief Fill a world-space rectangle
+     * @param pixels Target buffer
+     * @param view View transform
+     * @param x World x (truncated like GameWindow's QRect)
+     * @param y World y
+     * @param w World width
+     * @param h World height
+     * @param color Color (0xRRGGBB)
+     * @param alpha Opacity (0-255)
+     * @param ellipse Whether to fill the inscribed ellipse instead
+     */
+    void fill(std::uint8_t* pixels, const ViewTransform& view, int x, int y, int w, int h,
+              std::uint32_t color, int alpha, bool ellipse) const;
+
+    /**
+     * @brief Write one pixel span
+     * @param row Start of the span
+     * @param count Pixels in the span
+     * @param color Color in the target format
+     * @param alpha Opacity (0-255)
+     */
+    void writeSpan(std::uint8_t* row, int count, const std::uint8_t* color, int alpha) const;
+
+private:
+    int m_width;                             ///< Target width
+    int m_height;                            ///< Target height
+    int m_channels;                          ///< Bytes per pixel
+    std::vector<std::uint8_t> m_background;  ///< Pre-rendered sky gradient
+};
+
+#endif // PIXELRENDERER_H
@@ -10,12 +10,9 @@
 
 #include "Vector2D.h"
 #include "GameConfig.h"
-#include <memory>
-#include <QColor>
-
-// Forward declarations
-class Weapon;
-class Item;
+#include "Weapon.h"
+#include "BalanceConfig.h"
+#include "EntityWorld.h"
 
 /**
  * @brief Player state enumeration
@@ -41,28 +38,74 @@ enum class TerrainType {
  * @brief Player class
  * 
  * Handles all player functionality including movement, combat, health, etc.
+ * Position, velocity and ground state live in the player's entity in the EntityWorld,
+ * where they are integrated together with all other entities.
  */
 class Player {
 public:
     /**
      * @brief Constructor
+     * 
+     * Creates the player's entity in the world. The entity is owned by the world and is
+     * released when the world is cleared.
+     * @param world Entity world
+     * @param timers Timer wheel for cooldowns and effects (must outlive the player)
      * @param startPos Initial position
-     * @param playerColor Player color
-     * @param isPlayerOne Whether this is player one
+     * @param playerColor Player color (0xRRGGBB)
+     * @param index Player index
+     * @param team Team index (0 to GameConfig::MAX_TEAMS - 1)
+     * @param balance Balance parameters (must outlive the player)
      */
-    Player(const Vector2D& startPos, const QColor& playerColor, bool isPlayerOne);
+    Player(EntityWorld& world, TimerWheel& timers, const Vector2D& startPos, unsigned int playerColor, int index,
+           int team, const BalanceConfig& balance = BalanceConfig::defaults());
 
     /**
      * @brief Destructor
      */
     ~Player();
 
+    /**
+     * @brief Restore the initial state in a new entity, after the world and timers were cleared
+     * @param startPos Initial position
+     */
+    void respawn(const Vector2D& startPos);
+
+    /**
+     * @brief Write the player state that is not held in the world
+     * @param writer State writer
+     */
+    void saveState(StateWriter& writer) const;
+
+    /**
+     * @brief Restore a written player state, after the world was restored
+     * @param reader State reader
+     * @return bool Whether the state was read completely
+     */
+    bool restoreState(StateReader& reader);
+
     /**
      * @brief Update player state
+     * 
+     * Sets the horizontal velocity from input; integration happens in EntityWorld::integrate.
+     * Cooldowns and effects run on timers, see onTimer().
      * @param deltaTime Time delta in seconds
      */
     void update(double deltaTime);
 
+    /**
+     * @brief Handle a fired player timer
+     * 
+     * Events of timers the player has since replaced are ignored.
+     * @param event The event (target is this player's index)
+     */
+    void onTimer(const TimerEvent& event);
+
+    /**
+     * @brief Keep the player inside the world after integration
+     * @param worldWidth World width
+     */
+    void applyWorldBounds(double worldWidth);
+
     /**
      * @brief Move left
      */
@@ -100,10 +143,10 @@ public:
 
     /**
      * @brief Pick up an item
-     * @param item The item to pick up
+     * @param type The item type
      * @return bool Whether pickup was successful
      */
-    bool pickupItem(std::shared_ptr<Item> item);
+    bool pickupItem(ItemType type);
 
     /**
      * @brief Take damage
@@ -148,36 +191,42 @@ public:
     bool isInvisible() const;
 
     // Getter methods
-    Vector2D getPosition() const { return m_position; }
-    Vector2D getVelocity() const { return m_velocity; }
+    Entity getEntity() const { return m_entity; }
+    Vector2D getPosition() const { return m_world->motions.get(m_entity).position; }
+    Vector2D getVelocity() const { return m_world->motions.get(m_entity).velocity; }
     double getWidth() const { return GameConfig::PLAYER_WIDTH; }
     double getHeight() const { return GameConfig::PLAYER_HEIGHT; }
     int getHP() const { return m_hp; }
     int getMaxHP() const { return GameConfig::PLAYER_MAX_HP; }
     PlayerState getState() const { return m_state; }
-    QColor getColor() const { return m_color; }
+    unsigned int getColor() const { return m_color; }
     bool isFacingRight() const { return m_facingRight; }
-    bool getIsPlayerOne() const { return m_isPlayerOne; }
-    std::shared_ptr<Weapon> getWeapon() const { return m_weapon; }
+    int getIndex() const { return m_index; }
+    int getTeam() const { return m_team; }
+    std::uint32_t getTeamMask() const { return 1u << m_team; }
+    const BalanceConfig& getBalance() const { return *m_balance; }
+    const WeaponState& getWeapon() const { return m_weapon; }
+    WeaponState& getWeapon() { return m_weapon; }
+    std::int32_t getSupportPlatform() const { return m_supportPlatform; }
 
     // Setter methods
-    void setPosition(const Vector2D& pos) { m_position = pos; }
-    void setVelocity(const Vector2D& vel) { m_velocity = vel; }
-    void setWeapon(std::shared_ptr<Weapon> weapon) { m_weapon = weapon; }
-    void setGrounded(bool grounded) { m_isGrounded = grounded; }
+    void setPosition(const Vector2D& pos) { m_world->motions.get(m_entity).position = pos; }
+    void setVelocity(const Vector2D& vel) { m_world->motions.get(m_entity).velocity = vel; }
+    void setWeapon(const WeaponState& weapon) { m_weapon = weapon; }
+    void setGrounded(bool grounded) { m_world->gravities.get(m_entity).grounded = grounded; }
+    void setSupportPlatform(std::int32_t platform) { m_supportPlatform = platform; }
 
 private:
     /**
-     * @brief Update physics state
-     * @param deltaTime Time delta
+     * @brief Create the player's entity in the world
+     * @param startPos Initial position
      */
-    void updatePhysics(double deltaTime);
+    void createEntity(const Vector2D& startPos);
 
     /**
-     * @brief Update adrenaline effect
-     * @param deltaTime Time delta
+     * @brief Update horizontal movement
      */
-    void updateAdrenalineEffect(double deltaTime);
+    void updateMovement();
 
     /**
      * @brief Get current movement speed
@@ -186,11 +235,14 @@ private:
     double getCurrentMoveSpeed() const;
 
 private:
-    Vector2D m_position;         ///< Player position
-    Vector2D m_velocity;         ///< Player velocity
+    EntityWorld* m_world;        ///< World holding the player's entity
+    TimerWheel* m_timers;        ///< Timer wheel of the engine
+    const BalanceConfig* m_balance; ///< Balance parameters
+    Entity m_entity;             ///< Player entity
     PlayerState m_state;         ///< Player state
-    QColor m_color;              ///< Player color
-    bool m_isPlayerOne;          ///< Whether this is player one
+    unsigned int m_color;        ///< Player color (0xRRGGBB)
+    int m_index;                 ///< Player index
+    int m_team;                  ///< Team index
     bool m_facingRight;          ///< Whether facing right
     
     // Health related
@@ -200,19 +252,18 @@ private:
     bool m_isMovingLeft;         ///< Whether moving left
     bool m_isMovingRight;        ///< Whether moving right
     bool m_isCrouching;          ///< Whether crouching
-    bool m_isGrounded;           ///< Whether on ground
     
     // Terrain related
     TerrainType m_currentTerrain; ///< Current terrain type
+    std::int32_t m_supportPlatform; ///< Level platform index stood on last tick (-1: none)
     
     // Weapon system
-    std::shared_ptr<Weapon> m_weapon; ///< Current weapon
-    long long m_lastAttackTime;       ///< Last attack time
+    WeaponState m_weapon;             ///< Current weapon
+    TimerHandle m_attackGuard;        ///< Pending timer until the next attack is accepted
     
     // Status effects
-    bool m_hasAdrenaline;        ///< Whether has adrenaline effect
-    long long m_adrenalineEndTime; ///< Adrenaline effect end time
-    long long m_lastAdrenalineHeal; ///< Last adrenaline heal time
+    TimerHandle m_adrenalineEnd;  ///< Timer ending the adrenaline effect (NO_TIMER when inactive)
+    TimerHandle m_adrenalineHeal; ///< Timer of the next adrenaline heal
 };
 
 #endif // PLAYER_H 
\ No newline at end of file
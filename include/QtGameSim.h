@@ -0,0 +1,245 @@
+/**
+ * @file QtGameSim.h
+ * @brief C API of the embeddable simulation library (libqtgame_sim)
+ * @author Justin0828
+ * @date 2026-10-17
+ *
+ * Plain C interface for hosts that cannot link the Qt Widgets game: training and analysis
+ * tools in other languages load libqtgame_sim and drive matches through these functions.
+ * The library only depends on Qt Core.
+ *
+ * Every function that fills data writes into buffers owned by the caller; qtgame_step() and
+ * the read functions never allocate. A match may be used from any thread, but not from two
+ * threads at once. Different matches are independent.
+ *
+ * No C++ exception leaves the library. qtgame_create(), qtgame_reset(), qtgame_set_bot(),
+ * qtgame_step() and qtgame_restore() report failures (running out of memory or threads, an
+ * unreadable level) through their result; the other functions cannot fail.
+ */
+
+#ifndef QTGAMESIM_H
+#define QTGAMESIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(QTGAME_SIM_BUILD)
+#    define QTGAME_SIM_API __declspec(dllexport)
+#  else
+#    define QTGAME_SIM_API __declspec(dllimport)
+#  endif
+#else
+#  define QTGAME_SIM_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ABI version, bumped whenever a struct layout or function signature changes */
+#define QTGAME_SIM_ABI_VERSION 2
+
+/** Action bits of one player for one tick (same values as the engine's Action namespace) */
+enum {
+    QTGAME_ACTION_LEFT = 1,     /**< Move left */
+    QTGAME_ACTION_RIGHT = 2,    /**< Move right */
+    QTGAME_ACTION_JUMP = 4,     /**< Jump */
+    QTGAME_ACTION_CROUCH = 8,   /**< Crouch/pickup */
+    QTGAME_ACTION_FIRE = 16     /**< Attack/fire */
+};
+
+/** Match state */
+enum {
+    QTGAME_STATE_PLAYING = 0,   /**< Round in progress */
+    QTGAME_STATE_PAUSED = 1,    /**< Paused */
+    QTGAME_STATE_GAME_OVER = 2  /**< Round ended */
+};
+
+/** Built-in bots */
+enum {
+    QTGAME_BOT_NONE = -1,       /**< Player driven by qtgame_step() actions */
+    QTGAME_BOT_AGGRESSIVE = 0,  /**< Chases and attacks the nearest opponent */
+    QTGAME_BOT_COLLECTOR = 1,   /**< Collects items, otherwise aggressive */
+    QTGAME_BOT_RANDOM = 2       /**< Holds random actions */
+};
+
+/** Opaque match handle */
+typedef struct qtgame_match qtgame_match;
+
+/** Match parameters */
+typedef struct qtgame_config {
+    int32_t players;            /**< Players (at least 2) */
+    int32_t teams;              /**< Teams (0: one per player) */
+    uint32_t seed;              /**< Random seed */
+    const char* level_path;     /**< Baked level file, UTF-8 (NULL: built-in arena) */
+    const char* balance;        /**< Balance overrides "NAME=value,..." (NULL: defaults) */
+} qtgame_config;
+
+/** Summary of a match */
+typedef struct qtgame_match_state {
+    int32_t state;              /**< QTGAME_STATE_* */
+    int32_t winner;             /**< 0: none or draw, otherwise winning team + 1 */
+    int64_t tick;               /**< Ticks simulated since the last reset */
+    int32_t players;            /**< Number of players */
+    int32_t projectiles;        /**< Number of live projectiles */
+    int32_t items;              /**< Number of items on the map */
+    int32_t reserved;           /**< Always 0 */
+} qtgame_match_state;
+
+/** State of one player */
+typedef struct qtgame_player_state {
+    float x, y;                 /**< Top-left position */
+    float vx, vy;               /**< Velocity (pixels per second) */
+    int32_t hp;                 /**< Health points */
+    int32_t team;               /**< Team index */
+    int32_t weapon;             /**< Weapon type (0 fist, 1 knife, 2 ball, 3 rifle, 4 sniper) */
+    int32_t ammo;               /**< Remaining ammunition (-1: infinite) */
+    uint8_t alive;              /**< Non-zero while alive */
+    uint8_t grounded;           /**< Non-zero when standing on ground */
+    uint8_t facing_right;       /**< Non-zero when facing right */
+    uint8_t crouching;          /**< Non-zero when crouching */
+    uint8_t invisible;          /**< Non-zero when hidden in grass */
+    uint8_t can_attack;         /**< Non-zero when the weapon is ready */
+    uint8_t reserved[2];        /**< Always 0 */
+} qtgame_player_state;
+
+/** State of one projectile */
+typedef struct qtgame_projectile_state {
+    float x, y;                 /**< Center position */
+    float vx, vy;               /**< Velocity (pixels per second) */
+    int32_t damage;             /**< Damage on hit */
+    int32_t type;               /**< Ammunition type (0 melee, 1 bullet, 2 thrown) */
+    int32_t owner;              /**< Index of the player who fired it */
+    uint32_t team_mask;         /**< Owner team bit */
+} qtgame_projectile_state;
+
+/** State of one item */
+typedef struct qtgame_item_state {
+    float x, y;                 /**< Top-left position */
+    int32_t type;               /**< Item type (0 knife, 1 ball, 2 rifle, 3 sniper, 4 bandage, 5 medkit, 6 adrenaline) */
+    int32_t reserved;           /**< Always 0 */
+} qtgame_item_state;
+
+/**
+ * @brief Get the ABI version the library was built with
+ * @return uint32_t QTGAME_SIM_ABI_VERSION of the library
+ */
+QTGAME_SIM_API uint32_t qtgame_abi_version(void);
+
+/**
+ * @brief Create a match and start its first round
+ * @param config Parameters (NULL: two players on the built-in arena, seed 0)
+ * @param error Receives a message on failure (optional)
+ * @param error_size Size of error in bytes
+ * @return qtgame_match* The match, or NULL on failure
+ */
+QTGAME_SIM_API qtgame_match* qtgame_create(const qtgame_config* config, char* error, size_t error_size);
+
+/**
+ * @brief Destroy a match
+ * @param match The match (NULL is ignored)
+ */
+QTGAME_SIM_API void qtgame_destroy(qtgame_match* match);
+
+/**
+ * @brief Reseed the random generator (item drops and new random bots)
+ * @param match The match
+ * @param seed Random seed
+ */
+QTGAME_SIM_API void qtgame_seed(qtgame_match* match, uint32_t seed);
+
+/**
+ * @brief Start a new round; bots are kept
+ * @param match The match
+ * @return int 0 on success, -1 if the round could not be set up (destroy the match)
+ */
+QTGAME_SIM_API int qtgame_reset(qtgame_match* match);
+
+/**
+ * @brief Let a built-in bot drive a player, or return it to qtgame_step() actions
+ * @param match The match
+ * @param player Player index
+ * @param bot QTGAME_BOT_*
+ * @return int 0 on success, -1 for an unknown player or bot, or if the bot could not be created
+ */
+QTGAME_SIM_API int qtgame_set_bot(qtgame_match* match, int32_t player, int32_t bot);
+
+/**
+ * @brief Simulate ticks at the engine's fixed rate, holding the given actions
+ *
+ * Stops early when the round ends.
+ * @param match The match
+ * @param actions One QTGAME_ACTION_* mask per player (entries of bot-driven players are ignored)
+ * @param ticks Ticks to simulate
+ * @return int32_t QTGAME_STATE_* after the step, or -1 if the engine failed (reset or destroy the match)
+ */
+QTGAME_SIM_API int32_t qtgame_step(qtgame_match* match, const uint8_t* actions, int32_t ticks);
+
+/**
+ * @brief Read the match summary
+ * @param match The match
+ * @param out Receives the summary
+ */
+QTGAME_SIM_API void qtgame_read_match(const qtgame_match* match, qtgame_match_state* out);
+
+/**
+ * @brief Read all players in index order
+ * @param match The match
+ * @param out Receives up to capacity players
+ * @param capacity Entries available in out
+ * @return int32_t Number of players (may exceed capacity)
+ */
+QTGAME_SIM_API int32_t qtgame_read_players(const qtgame_match* match, qtgame_player_state* out, int32_t capacity);
+
+/**
+ * @brief Read the live projectiles
+ * @param match The match
+ * @param out Receives up to capacity projectiles
+ * @param capacity Entries available in out
+ * @return int32_t Number of projectiles (may exceed capacity)
+ */
+QTGAME_SIM_API int32_t qtgame_read_projectiles(const qtgame_match* match, qtgame_projectile_state* out,
+                                               int32_t capacity);
+
+/**
+ * @brief Read the items on the map
+ * @param match The match
+ * @param out Receives up to capacity items
+ * @param capacity Entries available in out
+ * @return int32_t Number of items (may exceed capacity)
+ */
+QTGAME_SIM_API int32_t qtgame_read_items(const qtgame_match* match, qtgame_item_state* out, int32_t capacity);
+
+/**
+ * @brief Write a snapshot of the simulation state
+ *
+ * The snapshot restores into any match created with the same level, player count and teams
+ * that has the same bot types set on the same players; the bots' memory is included. Its size
+ * changes with the number of entities.
+ * @param match The match
+ * @param buffer Target buffer (NULL to query the size)
+ * @param capacity Buffer size in bytes
+ * @return size_t Snapshot size; when it exceeds capacity the buffer holds no usable snapshot
+ */
+QTGAME_SIM_API size_t qtgame_snapshot(const qtgame_match* match, void* buffer, size_t capacity);
+
+/**
+ * @brief Restore a snapshot written by qtgame_snapshot()
+ *
+ * The match state, entity, timer and chunk bookkeeping, flags and table indices of the snapshot
+ * are checked, so a damaged snapshot is rejected instead of corrupting the match; positions,
+ * velocities and balance parameters are taken as they are. On failure the match is reset to a new round; if
+ * even that fails, it must be reset with qtgame_reset() or destroyed.
+ * @param match The match
+ * @param buffer Snapshot
+ * @param size Snapshot size in bytes
+ * @return int 0 on success, -1 if the snapshot is invalid or does not fit the match
+ */
+QTGAME_SIM_API int qtgame_restore(qtgame_match* match, const void* buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* QTGAMESIM_H */
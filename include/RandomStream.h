@@ -0,0 +1,131 @@
+/**
+ * @file RandomStream.h
+ * @brief Counter-based deterministic random number streams
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef RANDOMSTREAM_H
+#define RANDOMSTREAM_H
+
+#include <cstdint>
+
+/**
+ * @brief What a random stream is used for; each purpose draws from its own stream
+ */
+enum class RandomPurpose : std::uint32_t {
+    LOOT,           ///< Item types of drops
+    DROP_POSITION,  ///< Where items drop
+    BOT             ///< Bot decisions
+};
+
+/**
+ * @brief Counter-based random number stream (SplitMix64 output function)
+ *
+ * The n-th value is a fixed hash of the stream key and n, so a stream is only 16 bytes, can be
+ * copied into snapshots as is and can jump to any position. Keys are derived from a seed, a
+ * stream index (a match, an environment or a player) and a purpose, so every combination draws
+ * independent values that do not depend on how many values other streams consumed. The bounded
+ * helpers use fixed integer arithmetic, so results are the same with every standard library.
+ */
+class RandomStream {
+public:
+    using result_type = std::uint64_t;
+
+    /**
+     * @brief Constructor
+     * @param seed Random seed
+     * @param stream Stream index (match, environment or player)
+     * @param purpose What the values are used for
+     */
+    constexpr explicit RandomStream(std::uint64_t seed = 0, std::uint64_t stream = 0,
+                                    RandomPurpose purpose = RandomPurpose::LOOT)
+        : m_key(deriveKey(seed, stream, purpose)), m_counter(0) {}
+
+    /**
+     * @brief Draw the next 64-bit value
+     * @return std::uint64_t Uniform value
+     */
+    constexpr std::uint64_t next() {
+        return mix(m_key + ++m_counter * GOLDEN_GAMMA);
+    }
+
+    /**
+     * @brief Draw a value below a bound (multiply-shift, bias below 2^-32 for 32-bit bounds)
+     * @param bound Exclusive upper bound (0 returns 0)
+     * @return std::uint32_t Value in [0, bound)
+     */
+    constexpr std::uint32_t nextBelow(std::uint32_t bound) {
+        return static_cast<std::uint32_t>(((next() >> 32) * bound) >> 32);
+    }
+
+    /**
+     * @brief Draw an integer from a closed range
+     * @param min Smallest value
+     * @param max Largest value (at least min)
+     * @return int Value in [min, max]
+     */
+    constexpr int nextInt(int min, int max) {
+        return min + static_cast<int>(nextBelow(static_cast<std::uint32_t>(max - min) + 1u));
+    }
+
+    /**
+     * @brief Draw a double in [0, 1) from the top 53 bits
+     * @return double Uniform value
+     */
+    constexpr double nextDouble() {
+        return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * @brief Draw a double from a half-open range
+     * @param min Lower bound
+     * @param max Upper bound
+     * @return double Value in [min, max), min when the range is empty
+     */
+    constexpr double nextRange(double min, double max) {
+        return min + (max - min) * nextDouble();
+    }
+
+    // UniformRandomBitGenerator interface
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type{0}; }
+    constexpr result_type operator()() { return next(); }
+
+    // Getter/setter methods
+    std::uint64_t getCounter() const { return m_counter; }
+    void setCounter(std::uint64_t counter) { m_counter = counter; }
+
+private:
+    static constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull; ///< SplitMix64 increment
+
+    /**
+     * @brief SplitMix64 finalizer, a bijective 64-bit mix
+     * @param value Input
+     * @return std::uint64_t Mixed value
+     */
+    static constexpr std::uint64_t mix(std::uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * @brief Derive the key of a stream
+     * @param seed Random seed
+     * @param stream Stream index
+     * @param purpose Purpose
+     * @return std::uint64_t Stream key
+     */
+    static constexpr std::uint64_t deriveKey(std::uint64_t seed, std::uint64_t stream, RandomPurpose purpose) {
+        std::uint64_t key = mix(seed + GOLDEN_GAMMA);
+        key = mix(key ^ (stream + 1) * 0xD1B54A32D192ED03ull);
+        return mix(key ^ (static_cast<std::uint64_t>(purpose) + 1) * 0xAEF17502108EF2D9ull);
+    }
+
+private:
+    std::uint64_t m_key;      ///< Stream key
+    std::uint64_t m_counter;  ///< Values drawn so far
+};
+
+#endif // RANDOMSTREAM_H
@@ -0,0 +1,213 @@
+/**
+ * @file Raycast.h
+ * @brief Ray, circle cast and swept box queries against axis-aligned boxes
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef RAYCAST_H
+#define RAYCAST_H
+
+#include "Vector2D.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief First hit of a ray query
+ */
+struct RayHit {
+    double distance = 0.0;      ///< Distance along the ray
+    Vector2D point;             ///< Hit position of the ray
+    Vector2D normal;            ///< Surface normal of the hit box face (zero when the ray starts inside)
+    std::int32_t platform = -1; ///< Level platform index (-1: not a platform)
+    std::int32_t player = -1;   ///< Player index (-1: not a player)
+};
+
+/**
+ * @brief Intersect a ray with an axis-aligned box (slab test)
+ * @param origin Ray origin
+ * @param direction Unit ray direction
+ * @param boxMin Box minimum corner
+ * @param boxMax Box maximum corner
+ * @param maxDistance Hits beyond this distance are ignored
+ * @param distance Receives the entry distance (0 when the origin is inside)
+ * @param normal Receives the normal of the entered face
+ * @return bool Whether the ray enters the box within maxDistance
+ */
+inline bool intersectRayBox(const Vector2D& origin, const Vector2D& direction, const Vector2D& boxMin,
+                            const Vector2D& boxMax, double maxDistance, double& distance, Vector2D& normal) {
+    double enter = 0.0;
+    double exit = maxDistance;
+    Vector2D enterNormal;
+
+    const double origins[2] = {origin.x, origin.y};
+    const double directions[2] = {direction.x, direction.y};
+    const double mins[2] = {boxMin.x, boxMin.y};
+    const double maxs[2] = {boxMax.x, boxMax.y};
+    for (int axis = 0; axis < 2; ++axis) {
+        if (directions[axis] == 0.0) {
+            // Parallel to this slab: inside it or never
+            if (origins[axis] < mins[axis] || origins[axis] > maxs[axis]) return false;
+            continue;
+        }
+
+        double inverse = 1.0 / directions[axis];
+        double slabEnter = (mins[axis] - origins[axis]) * inverse;
+        double slabExit = (maxs[axis] - origins[axis]) * inverse;
+        double side = -1.0;
+        if (slabEnter > slabExit) {
+            std::swap(slabEnter, slabExit);
+            side = 1.0;
+        }
+        if (slabEnter > enter) {
+            enter = slabEnter;
+            enterNormal = axis == 0 ? Vector2D(side, 0) : Vector2D(0, side);
+        }
+        exit = std::min(exit, slabExit);
+        if (enter > exit) return false;
+    }
+
+    distance = enter;
+    normal = enterNormal;
+    return true;
+}
+
+/**
+ * @brief Intersect a ray with a circle
+ * @param origin Ray origin
+ * @param direction Unit ray direction
+ * @param center Circle center
+ * @param radius Circle radius
+ * @param maxDistance Hits beyond this distance are ignored
+ * @param distance Receives the entry distance (0 when the origin is inside)
+ * @return bool Whether the ray enters the circle within maxDistance
+ */
+inline bool intersectRayCircle(const Vector2D& origin, const Vector2D& direction, const Vector2D& center,
+                               double radius, double maxDistance, double& distance) {
+    Vector2D offset = origin - center;
+    double c = offset.dot(offset) - radius * radius;
+    if (c <= 0.0) {
+        distance = 0.0;
+        return true;
+    }
+
+    // |offset + direction * t|^2 = radius^2 with |direction| = 1
+    double b = offset.dot(direction);
+    double discriminant = b * b - c;
+    if (b >= 0.0 || discriminant < 0.0) return false;
+    double entry = -b - std::sqrt(discriminant);
+    if (entry > maxDistance) return false;
+    distance = entry;
+    return true;
+}
+
+/**
+ * @brief Cast a circle along a ray against an axis-aligned box
+ *
+ * The circle touches the box when its center enters the box with rounded corners: the box
+ * grown by the radius horizontally, grown vertically, or one of the four corner circles.
+ * @param origin Circle center at distance 0
+ * @param direction Unit cast direction
+ * @param radius Circle radius (0 for a thin ray)
+ * @param boxMin Box minimum corner
+ * @param boxMax Box maximum corner
+ * @param maxDistance Hits beyond this distance are ignored
+ * @param distance Receives the distance at first contact (0 when already touching)
+ * @param normal Receives the box surface normal at the contact
+ * @return bool Whether the circle touches the box within maxDistance
+ */
+inline bool intersectCircleCastBox(const Vector2D& origin, const Vector2D& direction, double radius,
+                                   const Vector2D& boxMin, const Vector2D& boxMax, double maxDistance,
+                                   double& distance, Vector2D& normal) {
+    if (radius <= 0.0) return intersectRayBox(origin, direction, boxMin, boxMax, maxDistance, distance, normal);
+
+    // Nothing to do unless the square-cornered grown box is entered at all
+    Vector2D grow(radius, radius);
+    double nearest = 0.0;
+    if (!intersectRayBox(origin, direction, boxMin - grow, boxMax + grow, maxDistance, nearest, normal)) return false;
+
+    bool found = false;
+    double slabDistance = 0.0;
+    Vector2D slabNormal;
+    if (intersectRayBox(origin, direction, Vector2D(boxMin.x - radius, boxMin.y), Vector2D(boxMax.x + radius, boxMax.y),
+                        maxDistance, slabDistance, slabNormal)) {
+        distance = slabDistance;
+        normal = slabNormal;
+        found = true;
+    }
+    if (intersectRayBox(origin, direction, Vector2D(boxMin.x, boxMin.y - radius), Vector2D(boxMax.x, boxMax.y + radius),
+                        found ? distance : maxDistance, slabDistance, slabNormal) &&
+        (!found || slabDistance < distance)) {
+        distance = slabDistance;
+        normal = slabNormal;
+        found = true;
+    }
+
+    const Vector2D corners[4] = {boxMin, Vector2D(boxMax.x, boxMin.y), Vector2D(boxMin.x, boxMax.y), boxMax};
+    for (const Vector2D& corner : corners) {
+        double cornerDistance = 0.0;
+        if (!intersectRayCircle(origin, direction, corner, radius, found ? distance : maxDistance, cornerDistance)) {
+            continue;
+        }
+        if (found && cornerDistance >= distance) continue;
+        distance = cornerDistance;
+        Vector2D away = origin + direction * cornerDistance - corner;
+        double length = away.length();
+        normal = length > 0.0 ? away / length : Vector2D();
+        found = true;
+    }
+    return found;
+}
+
+/**
+ * @brief Sweep a moving box against a static axis-aligned box (swept AABB)
+ *
+ * Only overlapping interiors count, so boxes sliding along each other's faces do not collide.
+ * @param min Moving box minimum corner at time 0
+ * @param max Moving box maximum corner at time 0
+ * @param displacement Movement of the box from time 0 to time 1
+ * @param boxMin Static box minimum corner
+ * @param boxMax Static box maximum corner
+ * @param time Receives the time of first contact (0 when the interiors overlap at time 0)
+ * @param normal Receives the normal of the static box face that was hit (zero when overlapping at time 0)
+ * @return bool Whether the interiors overlap at some time in [0, 1)
+ */
+inline bool sweepBoxBox(const Vector2D& min, const Vector2D& max, const Vector2D& displacement,
+                        const Vector2D& boxMin, const Vector2D& boxMax, double& time, Vector2D& normal) {
+    double enter = 0.0;
+    double exit = 1.0;
+    Vector2D enterNormal;
+
+    // Per axis, the interiors overlap while the offset lies strictly between these bounds
+    const double lows[2] = {boxMin.x - max.x, boxMin.y - max.y};
+    const double highs[2] = {boxMax.x - min.x, boxMax.y - min.y};
+    const double displacements[2] = {displacement.x, displacement.y};
+    for (int axis = 0; axis < 2; ++axis) {
+        if (displacements[axis] == 0.0) {
+            if (lows[axis] >= 0.0 || highs[axis] <= 0.0) return false;
+            continue;
+        }
+
+        double axisEnter = lows[axis] / displacements[axis];
+        double axisExit = highs[axis] / displacements[axis];
+        double side = -1.0;
+        if (axisEnter > axisExit) {
+            std::swap(axisEnter, axisExit);
+            side = 1.0;
+        }
+        if (axisEnter > enter) {
+            enter = axisEnter;
+            enterNormal = axis == 0 ? Vector2D(side, 0) : Vector2D(0, side);
+        }
+        exit = std::min(exit, axisExit);
+        if (enter >= exit) return false;
+    }
+
+    time = enter;
+    normal = enterNormal;
+    return true;
+}
+
+#endif // RAYCAST_H
@@ -0,0 +1,167 @@
+/**
+ * @file StateBuffer.h
+ * @brief Binary simulation state writer and reader
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef STATEBUFFER_H
+#define STATEBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Writes plain values into a caller-provided byte buffer
+ *
+ * Writing past the capacity is not an error by itself: the bytes are dropped and overflowed()
+ * reports it, while getSize() keeps counting. A writer without a buffer therefore measures the
+ * size a state needs.
+ */
+class StateWriter {
+public:
+    /**
+     * @brief Constructor
+     * @param data Target buffer (nullptr to only measure)
+     * @param capacity Buffer size in bytes
+     */
+    StateWriter(void* data, std::size_t capacity)
+        : m_data(static_cast<std::uint8_t*>(data)), m_capacity(data ? capacity : 0), m_size(0) {}
+
+    /**
+     * @brief Write raw bytes
+     * @param bytes Source
+     * @param count Number of bytes
+     */
+    void writeBytes(const void* bytes, std::size_t count) {
+        if (count > 0 && m_size + count <= m_capacity) {
+            std::memcpy(m_data + m_size, bytes, count);
+        }
+        m_size += count;
+    }
+
+    /**
+     * @brief Write a trivially copyable value
+     * @param value The value
+     */
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "state values must be trivially copyable");
+        writeBytes(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Write a vector of trivially copyable values with its length
+     * @param values The values
+     */
+    template<typename T>
+    void writeVector(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "state values must be trivially copyable");
+        write(static_cast<std::uint32_t>(values.size()));
+        writeBytes(values.data(), values.size() * sizeof(T));
+    }
+
+    // Getter methods
+    std::size_t getSize() const { return m_size; }
+    bool overflowed() const { return m_size > m_capacity; }
+
+private:
+    std::uint8_t* m_data;     ///< Target buffer
+    std::size_t m_capacity;   ///< Buffer size
+    std::size_t m_size;       ///< Bytes written (or needed)
+};
+
+/**
+ * @brief Reads values written by a StateWriter
+ *
+ * Reading past the end fails the reader; every later read fails as well, so callers can check
+ * isValid() once at the end.
+ */
+class StateReader {
+public:
+    /**
+     * @brief Constructor
+     * @param data Source buffer
+     * @param size Buffer size in bytes
+     */
+    StateReader(const void* data, std::size_t size)
+        : m_data(static_cast<const std::uint8_t*>(data)), m_size(data ? size : 0), m_offset(0), m_valid(true) {}
+
+    /**
+     * @brief Read raw bytes
+     * @param bytes Target
+     * @param count Number of bytes
+     * @return bool Whether the bytes were available
+     */
+    bool readBytes(void* bytes, std::size_t count) {
+        if (!m_valid || count > m_size - m_offset) {
+            m_valid = false;
+            return false;
+        }
+        if (count > 0) {
+            std::memcpy(bytes, m_data + m_offset, count);
+        }
+        m_offset += count;
+        return true;
+    }
+
+    /**
+     * @brief Read a trivially copyable value
+     * @param value Receives the value
+     * @return bool Whether the value was available
+     */
+    template<typename T>
+    bool read(T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "state values must be trivially copyable");
+        return readBytes(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Read a flag, rejecting bytes other than 0 and 1
+     * @param value Receives the flag
+     * @return bool Whether a valid flag was available
+     */
+    bool read(bool& value) {
+        std::uint8_t byte = 0;
+        if (!readBytes(&byte, 1) || byte > 1) {
+            m_valid = false;
+            return false;
+        }
+        value = byte != 0;
+        return true;
+    }
+
+    /**
+     * @brief Read a vector written by StateWriter::writeVector
+     *
+     * Reuses the vector's capacity, so restoring into a warmed-up state does not allocate.
+     * @param values Receives the values
+     * @return bool Whether the values were available
+     */
+    template<typename T>
+    bool readVector(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "state values must be trivially copyable");
+        std::uint32_t count = 0;
+        if (!read(count) || count > (m_size - m_offset) / sizeof(T)) {
+            m_valid = false;
+            return false;
+        }
+        values.resize(count);
+        return readBytes(values.data(), count * sizeof(T));
+    }
+
+    // Getter methods
+    bool isValid() const { return m_valid; }
+    bool atEnd() const { return m_offset == m_size; }
+
+private:
+    const std::uint8_t* m_data;   ///< Source buffer
+    std::size_t m_size;           ///< Buffer size
+    std::size_t m_offset;         ///< Read position
+    bool m_valid;                 ///< Whether every read so far succeeded
+};
+
+#endif // STATEBUFFER_H
@@ -0,0 +1,234 @@
+/**
+ * @file TimerWheel.h
+ * @brief Hierarchical timing wheel for simulated-time events
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include "StateBuffer.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Timer handle (NO_TIMER when none is pending)
+ */
+using TimerHandle = std::uint32_t;
+
+constexpr TimerHandle NO_TIMER = 0; ///< Null timer handle
+
+/**
+ * @brief Kind of a timed event, telling the engine how to dispatch it
+ */
+enum class TimerKind : std::uint8_t {
+    ITEM_DROP,          ///< Drop a random item (target unused)
+    ENTITY_EXPIRY,      ///< Destroy an entity (target: entity)
+    WEAPON_READY,       ///< Weapon cooldown elapsed (target: player index)
+    ATTACK_READY,       ///< Attack guard elapsed (target: player index)
+    ADRENALINE_HEAL,    ///< Adrenaline heal tick (target: player index)
+    ADRENALINE_END      ///< Adrenaline wears off (target: player index)
+};
+
+/**
+ * @brief A fired timer
+ */
+struct TimerEvent {
+    TimerKind kind;         ///< Event kind
+    std::uint32_t target;   ///< Entity or player index, depending on kind
+    TimerHandle handle;     ///< Handle returned by schedule()
+};
+
+/**
+ * @brief Hierarchical timing wheel in simulated milliseconds
+ *
+ * Four levels of slots: 256 one-millisecond slots, then three levels of 64 slots each covering
+ * 64 times the span of the level below (about 18.6 hours in total; later deadlines are held at
+ * the top level until they come into range). Scheduling, cancelling and firing are O(1); a
+ * timer moves down at most three times before it fires. Timers due in the same millisecond
+ * fire in a fixed order, so runs are reproducible.
+ *
+ * Handles carry a generation, so a handle kept after its timer fired or was cancelled never
+ * matches a newer timer. Owners compare the handle of a fired event with the one they stored
+ * to ignore events of timers they have replaced.
+ */
+class TimerWheel {
+public:
+    /**
+     * @brief Constructor
+     */
+    TimerWheel();
+
+    /**
+     * @brief Drop every timer and restart the clock at 0
+     */
+    void clear();
+
+    /**
+     * @brief Make room for a number of pending timers, so scheduling them does not allocate
+     * @param capacity Pending timers
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Schedule an event
+     * @param delay Delay in milliseconds (at least 1 is used)
+     * @param kind Event kind
+     * @param target Entity or player index
+     * @return TimerHandle Handle of the timer
+     */
+    TimerHandle schedule(std::int64_t delay, TimerKind kind, std::uint32_t target);
+
+    /**
+     * @brief Cancel a pending timer
+     * @param handle Timer handle (stale handles are ignored)
+     * @return bool Whether a timer was cancelled
+     */
+    bool cancel(TimerHandle handle);
+
+    /**
+     * @brief Check if a timer is pending
+     * @param handle Timer handle
+     * @return bool Whether the timer has neither fired nor been cancelled
+     */
+    bool isPending(TimerHandle handle) const { return findNode(handle) >= 0; }
+
+    /**
+     * @brief Get the time a pending timer fires at
+     * @param handle Timer handle
+     * @return std::int64_t Deadline in milliseconds (-1 if not pending)
+     */
+    std::int64_t getDeadline(TimerHandle handle) const;
+
+    /**
+     * @brief Advance the clock, firing every timer that comes due
+     *
+     * The handler may schedule and cancel timers; new timers fire no earlier than the next
+     * millisecond.
+     * @param elapsed Milliseconds to advance
+     * @param handler Called as handler(const TimerEvent&) for each fired timer
+     */
+    template<typename Handler>
+    void advance(std::int64_t elapsed, Handler&& handler) {
+        for (std::int64_t step = 0; step < elapsed; ++step) {
+            if (m_pending == 0) {
+                m_time += elapsed - step;
+                return;
+            }
+
+            ++m_time;
+            cascadeDue();
+
+            std::int32_t slot = static_cast<std::int32_t>(m_time & (LEVEL0_SLOTS - 1));
+            while (m_heads[slot] >= 0) {
+                std::int32_t index = m_heads[slot];
+                TimerEvent event{m_nodes[index].kind, m_nodes[index].target, handleOf(index)};
+                unlink(index);
+                release(index);
+                handler(event);
+            }
+        }
+    }
+
+    /**
+     * @brief Write the clock and every pending timer
+     * @param writer State writer
+     */
+    void saveState(StateWriter& writer) const;
+
+    /**
+     * @brief Restore state written by saveState()
+     * @param reader State reader
+     * @return bool Whether the state was read completely and every node is linked or free exactly once
+     */
+    bool restoreState(StateReader& reader);
+
+    // Getter methods
+    std::int64_t getTime() const { return m_time; }
+    std::size_t getPendingCount() const { return m_pending; }
+
+private:
+    static constexpr int LEVEL0_BITS = 8;                    ///< Bits resolved by the first level
+    static constexpr int LEVEL_BITS = 6;                     ///< Bits resolved by each higher level
+    static constexpr int LEVELS = 4;                         ///< Number of levels
+    static constexpr int LEVEL0_SLOTS = 1 << LEVEL0_BITS;    ///< Slots of the first level
+    static constexpr int LEVEL_SLOTS = 1 << LEVEL_BITS;      ///< Slots of each higher level
+    static constexpr int INDEX_BITS = 20;                    ///< Handle bits holding the node index
+    static constexpr std::uint32_t GENERATIONS = 1u << (32 - INDEX_BITS); ///< Generations per node
+
+    /**
+     * @brief Timer node, linked into the list of its slot
+     */
+    struct Node {
+        std::int64_t deadline;      ///< Fire time in milliseconds
+        std::uint32_t target;       ///< Event target
+        TimerKind kind;             ///< Event kind
+        std::uint16_t generation;   ///< Bumped on every reuse (never 0)
+        std::int32_t prev;          ///< Previous node in the slot (-1: slot head)
+        std::int32_t next;          ///< Next node in the slot (-1: last)
+        std::int32_t slot;          ///< Slot holding the node (-1: free)
+    };
+
+    /**
+     * @brief Get the bit position where a level starts
+     * @param level Level (1 to LEVELS - 1)
+     * @return int Shift of the level's slot index
+     */
+    static constexpr int levelShift(int level) { return LEVEL0_BITS + (level - 1) * LEVEL_BITS; }
+
+    /**
+     * @brief Pick the slot for a deadline relative to the current time
+     * @param deadline Fire time
+     * @return std::int32_t Slot index
+     */
+    std::int32_t slotFor(std::int64_t deadline) const;
+
+    /**
+     * @brief Move the timers of higher-level slots that came into range down
+     */
+    void cascadeDue();
+
+    /**
+     * @brief Link a node into the slot for its deadline
+     * @param index Node index
+     */
+    void insert(std::int32_t index);
+
+    /**
+     * @brief Unlink a node from its slot
+     * @param index Node index
+     */
+    void unlink(std::int32_t index);
+
+    /**
+     * @brief Return a node to the free list
+     * @param index Node index
+     */
+    void release(std::int32_t index);
+
+    /**
+     * @brief Find the node of a pending timer
+     * @param handle Timer handle
+     * @return std::int32_t Node index (-1 if not pending)
+     */
+    std::int32_t findNode(TimerHandle handle) const;
+
+    /**
+     * @brief Build the handle of a node
+     * @param index Node index
+     * @return TimerHandle Handle
+     */
+    TimerHandle handleOf(std::int32_t index) const {
+        return static_cast<TimerHandle>(m_nodes[index].generation) << INDEX_BITS | static_cast<TimerHandle>(index);
+    }
+
+private:
+    std::int64_t m_time;                    ///< Current time in milliseconds
+    std::vector<Node> m_nodes;              ///< Timer nodes
+    std::vector<std::int32_t> m_freeNodes;  ///< Reusable node indices
+    std::vector<std::int32_t> m_heads;      ///< First node per slot (-1: empty), all levels back to back
+    std::size_t m_pending;                  ///< Pending timers
+};
+
+#endif // TIMERWHEEL_H
@@ -0,0 +1,178 @@
+/**
+ * @file VecEnv.h
+ * @brief Vectorized training environment definition
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#ifndef VECENV_H
+#define VECENV_H
+
+#include "GameEngine.h"
+#include "PixelRenderer.h"
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Vectorized environment parameters
+ */
+struct VecEnvConfig {
+    int envCount = 64;                        ///< Engines stepped in lockstep
+    int threads = 0;                          ///< Threads stepping them, including the caller (0: one per core)
+    int players = 2;                          ///< Players per engine
+    int teams = 0;                            ///< Teams per engine (0: one per player)
+    int agents = 1;                           ///< Players per engine driven by the action array (the first ones)
+    BotType opponent = BotType::AGGRESSIVE;   ///< Bot driving the remaining players
+    int frameSkip = 1;                        ///< Engine ticks per step, repeating the action
+    int maxEpisodeTicks = 10800;              ///< Ticks after which an episode is cut off
+    unsigned int seed = 1;                    ///< Random seed (engine i draws from match stream i)
+    BalanceConfig balance;                    ///< Balance parameters
+    int pixelWidth = 0;                       ///< Pixel observation width (0: no pixel observations)
+    int pixelHeight = 0;                      ///< Pixel observation height
+    PixelFormat pixelFormat = PixelFormat::GRAY8; ///< Pixel observation format
+    Vector2D pixelView = Vector2D(GameConfig::WINDOW_WIDTH, GameConfig::WINDOW_HEIGHT); ///< World size shown in a pixel observation
+};
+
+/**
+ * @brief Steps many engines in lockstep for agent training
+ *
+ * step() takes one ActionMask per agent and writes observations, rewards and done flags for
+ * all agents into buffers allocated once at construction. Agent a of engine e uses row
+ * e * getAgentCount() + a. An engine whose round ended or ran out of ticks is reset inside
+ * the same step; its done flag is set and its observation row already shows the new episode.
+ *
+ * Observation row layout (all floats, positions relative to the agent and scaled by the world size):
+ * - self: x, y, vx, vy, hp, grounded, facing, can attack, ammo fraction, weapon one-hot
+ * - every other player by index: dx, dy, vx, vy, hp, alive, ally, visible
+ * - nearest MAX_PROJECTILES projectiles: dx, dy, vx, vy, hostile, present
+ * - nearest MAX_ITEMS items: dx, dy, present, item type one-hot
+ *
+ * With pixelWidth and pixelHeight set, every agent additionally gets a PixelRenderer frame of
+ * getPixelFrameSize() bytes at the same row index, showing pixelView world pixels centered on
+ * the agent. Frames are rendered by the thread that stepped the environment.
+ *
+ * Reward per step: hp lost by opponents minus hp lost by the agent's team, in units of max hp,
+ * plus 1 for a won and -1 for a lost round.
+ */
+class VecEnv {
+public:
+    static constexpr int MAX_PROJECTILES = 8;                             ///< Projectile slots per observation
+    static constexpr int MAX_ITEMS = 4;                                   ///< Item slots per observation
+    static constexpr int SELF_FEATURES = 9 + WEAPON_TYPE_COUNT;           ///< Features of the agent
+    static constexpr int PLAYER_FEATURES = 8;                             ///< Features per other player
+    static constexpr int PROJECTILE_FEATURES = 6;                         ///< Features per projectile
+    static constexpr int ITEM_FEATURES = 3 + ITEM_TYPE_COUNT;             ///< Features per item
+
+    /**
+     * @brief Constructor, creates the engines and threads and resets all environments
+     * @param config Parameters
+     */
+    explicit VecEnv(const VecEnvConfig& config);
+
+    /**
+     * @brief Destructor, stops the threads
+     */
+    ~VecEnv();
+
+    VecEnv(const VecEnv&) = delete;
+    VecEnv& operator=(const VecEnv&) = delete;
+
+    /**
+     * @brief Load a baked level file into every environment and reset them
+     * @param path Level file path
+     * @param error Receives a message on failure (optional)
+     * @return bool Whether the level was loaded
+     */
+    bool loadLevel(const QString& path, QString* error = nullptr);
+
+    /**
+     * @brief Start a new episode in every environment and write the first observations
+     */
+    void reset();
+
+    /**
+     * @brief Advance every environment by one step
+     * @param actions getEnvCount() * getAgentCount() held action sets
+     */
+    void step(const ActionMask* actions);
+
+    // Getter methods
+    int getEnvCount() const { return m_config.envCount; }
+    int getAgentCount() const { return m_config.agents; }
+    int getThreadCount() const { return m_threadCount; }
+    int getObservationSize() const { return m_observationSize; }
+    const float* getObservations() const { return m_observations.data(); }
+    const float* getRewards() const { return m_rewards.data(); }
+    const std::uint8_t* getDones() const { return m_dones.data(); }
+    std::size_t getPixelFrameSize() const { return m_renderer ? m_renderer->getFrameSize() : 0; }
+    const std::uint8_t* getPixels() const { return m_pixels.data(); }
+    const GameEngine& getEngine(int env) const { return *m_engines[env]; }
+
+private:
+    /**
+     * @brief Step the environments assigned to a thread
+     * @param thread Thread index (the caller is 0)
+     */
+    void stepRange(int thread);
+
+    /**
+     * @brief Start a new episode in one environment
+     * @param env Environment index
+     */
+    void resetEnv(int env);
+
+    /**
+     * @brief Write the observation rows of one environment
+     * @param env Environment index
+     */
+    void writeObservations(int env);
+    
+    /**
+     * @brief Render the pixel observations of one environment
+     * @param env Environment index
+     */
+    void renderPixels(int env);
+
+    /**
+     * @brief Thread loop: wait for a step, process the thread's range, report completion
+     * @param thread Thread index (1-based; the caller is 0)
+     */
+    void workerLoop(int thread);
+
+    /**
+     * @brief Nearest entity candidate during observation building
+     */
+    struct Nearest {
+        double distance;    ///< Distance to the agent
+        std::size_t index;  ///< Index in the component pool
+    };
+
+private:
+    VecEnvConfig m_config;                              ///< Parameters
+    int m_observationSize;                              ///< Floats per agent row
+    std::vector<std::unique_ptr<GameEngine>> m_engines; ///< Environments
+    std::vector<int> m_episodeTicks;                    ///< Ticks played in the current episode per environment
+    std::vector<int> m_previousHP;                      ///< Player hp after the previous step (env * players + player)
+    std::vector<float> m_observations;                  ///< Observation rows
+    std::vector<float> m_rewards;                       ///< Reward per agent
+    std::vector<std::uint8_t> m_dones;                  ///< Episode ended this step, per environment
+    std::unique_ptr<const PixelRenderer> m_renderer;    ///< Pixel observation renderer (null: disabled)
+    std::vector<std::uint8_t> m_pixels;                 ///< Pixel observation frames
+
+    // Lockstep thread pool
+    int m_threadCount;                                  ///< Threads stepping, including the caller
+    std::vector<std::thread> m_threads;                 ///< Helper threads (the caller works as thread 0)
+    std::mutex m_mutex;                                 ///< Guards the fields below
+    std::condition_variable m_wake;                     ///< Signals a new step
+    std::condition_variable m_finished;                 ///< Signals a finished range
+    long long m_generation;                             ///< Step counter the threads wait on
+    int m_pending;                                      ///< Helper threads still working on the step
+    bool m_stopping;                                    ///< Set to end the threads
+    const ActionMask* m_actions;                        ///< Actions of the current step
+};
+
+#endif // VECENV_H
@@ -1,6 +1,6 @@
 /**
  * @file Vector2D.h
- * @brief 2D vector class definition
+ * @brief 2D vector template and engine scalar type definitions
  * @author Justin0828
  * @date 2025-07-23
  */
@@ -9,95 +9,242 @@
 #define VECTOR2D_H
 
 #include <cmath>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define QTGAME_VECTOR_SSE2 1
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief 16.16 fixed-point number
+ * 
+ * Bit-exact across platforms and compilers, for deterministic simulation.
+ */
+class Fixed {
+public:
+    static constexpr int FRACTION_BITS = 16;              ///< Fractional bits
+    static constexpr std::int32_t ONE = 1 << FRACTION_BITS; ///< Raw value of 1.0
+
+    std::int32_t raw; ///< Raw 16.16 value
+
+    constexpr Fixed() : raw(0) {}
+    constexpr Fixed(int value) : raw(value * ONE) {}
+    constexpr Fixed(double value) : raw(static_cast<std::int32_t>(value * ONE + (value >= 0 ? 0.5 : -0.5))) {}
+
+    /**
+     * @brief Construct from raw 16.16 value
+     * @param value Raw value
+     * @return Fixed Fixed-point number
+     */
+    static constexpr Fixed fromRaw(std::int32_t value) { Fixed f; f.raw = value; return f; }
+
+    constexpr double toDouble() const { return static_cast<double>(raw) / ONE; }
+    explicit constexpr operator double() const { return toDouble(); }
+
+    constexpr Fixed operator+(Fixed other) const { return fromRaw(raw + other.raw); }
+    constexpr Fixed operator-(Fixed other) const { return fromRaw(raw - other.raw); }
+    constexpr Fixed operator-() const { return fromRaw(-raw); }
+    constexpr Fixed operator*(Fixed other) const {
+        return fromRaw(static_cast<std::int32_t>((static_cast<std::int64_t>(raw) * other.raw) >> FRACTION_BITS));
+    }
+    constexpr Fixed operator/(Fixed other) const {
+        return fromRaw(static_cast<std::int32_t>((static_cast<std::int64_t>(raw) * ONE) / other.raw));
+    }
+    constexpr Fixed& operator+=(Fixed other) { raw += other.raw; return *this; }
+    constexpr Fixed& operator-=(Fixed other) { raw -= other.raw; return *this; }
+    constexpr bool operator==(Fixed other) const { return raw == other.raw; }
+    constexpr bool operator!=(Fixed other) const { return raw != other.raw; }
+    constexpr bool operator<(Fixed other) const { return raw < other.raw; }
+};
 
 /**
- * @brief 2D vector class
+ * @brief Square root of a fixed-point number
+ * @param value Non-negative value
+ * @return Fixed Square root
+ */
+inline Fixed sqrt(Fixed value) {
+    return Fixed(std::sqrt(value.toDouble()));
+}
+
+/**
+ * @brief 2D vector template
  * 
- * Used to represent 2D vector quantities like position, velocity, acceleration, etc. in the game
+ * Used to represent 2D vector quantities like position, velocity, acceleration, etc. in the game.
+ * Arithmetic is constexpr and header-only so it inlines everywhere; length-based operations use
+ * packed SSE2 for float and double where available.
  */
-class Vector2D {
+template <typename T>
+class Vector2 {
 public:
-    double x; ///< X coordinate
-    double y; ///< Y coordinate
+    T x; ///< X coordinate
+    T y; ///< Y coordinate
 
     /**
      * @brief Default constructor
      */
-    Vector2D() : x(0), y(0) {}
+    constexpr Vector2() : x(0), y(0) {}
 
     /**
      * @brief Constructor
      * @param x X coordinate
      * @param y Y coordinate
      */
-    Vector2D(double x, double y) : x(x), y(y) {}
+    constexpr Vector2(T x, T y) : x(x), y(y) {}
 
     /**
      * @brief Vector addition
      * @param other Another vector
-     * @return Vector2D Addition result
+     * @return Vector2 Addition result
      */
-    Vector2D operator+(const Vector2D& other) const;
+    constexpr Vector2 operator+(const Vector2& other) const { return Vector2(x + other.x, y + other.y); }
 
     /**
      * @brief Vector subtraction
      * @param other Another vector
-     * @return Vector2D Subtraction result
+     * @return Vector2 Subtraction result
      */
-    Vector2D operator-(const Vector2D& other) const;
+    constexpr Vector2 operator-(const Vector2& other) const { return Vector2(x - other.x, y - other.y); }
 
     /**
      * @brief Scalar multiplication
      * @param scalar Scalar value
-     * @return Vector2D Scalar multiplication result
+     * @return Vector2 Scalar multiplication result
      */
-    Vector2D operator*(double scalar) const;
+    constexpr Vector2 operator*(T scalar) const { return Vector2(x * scalar, y * scalar); }
 
     /**
      * @brief Scalar division
      * @param scalar Scalar value
-     * @return Vector2D Scalar division result
+     * @return Vector2 Scalar division result (zero vector when dividing by zero)
      */
-    Vector2D operator/(double scalar) const;
+    constexpr Vector2 operator/(T scalar) const {
+        return scalar != T(0) ? Vector2(x / scalar, y / scalar) : Vector2();
+    }
 
     /**
      * @brief Vector addition assignment
      * @param other Another vector
-     * @return Vector2D& Self reference
+     * @return Vector2& Self reference
      */
-    Vector2D& operator+=(const Vector2D& other);
+    constexpr Vector2& operator+=(const Vector2& other) { x += other.x; y += other.y; return *this; }
 
     /**
      * @brief Vector subtraction assignment
      * @param other Another vector
-     * @return Vector2D& Self reference
+     * @return Vector2& Self reference
      */
-    Vector2D& operator-=(const Vector2D& other);
+    constexpr Vector2& operator-=(const Vector2& other) { x -= other.x; y -= other.y; return *this; }
 
     /**
-     * @brief Calculate vector length
-     * @return double Vector length
+     * @brief Dot product
+     * @param other Another vector
+     * @return T Dot product
      */
-    double length() const;
+    constexpr T dot(const Vector2& other) const { return x * other.x + y * other.y; }
 
     /**
      * @brief Calculate squared vector length
-     * @return double Squared vector length
+     * @return T Squared vector length
+     */
+    constexpr T lengthSquared() const { return x * x + y * y; }
+
+    /**
+     * @brief Calculate vector length
+     * @return T Vector length
      */
-    double lengthSquared() const;
+    T length() const;
 
     /**
      * @brief Normalize vector
-     * @return Vector2D Normalized vector
+     * @return Vector2 Normalized vector (zero vector stays zero)
      */
-    Vector2D normalized() const;
+    Vector2 normalized() const {
+        T len = length();
+        return len != T(0) ? *this / len : Vector2();
+    }
 
     /**
      * @brief Calculate distance between two points
      * @param other Another point
-     * @return double Distance
+     * @return T Distance
+     */
+    T distanceTo(const Vector2& other) const { return (*this - other).length(); }
+
+    /**
+     * @brief Fused multiply-add, this += direction * scale
+     * @param direction Direction vector
+     * @param scale Scale factor
+     * @return Vector2& Self reference
      */
-    double distanceTo(const Vector2D& other) const;
+    Vector2& addScaled(const Vector2& direction, T scale);
 };
 
-#endif // VECTOR2D_H 
\ No newline at end of file
+template <typename T>
+inline T Vector2<T>::length() const {
+    using std::sqrt;
+    return sqrt(lengthSquared());
+}
+
+template <typename T>
+inline Vector2<T>& Vector2<T>::addScaled(const Vector2& direction, T scale) {
+    x += direction.x * scale;
+    y += direction.y * scale;
+    return *this;
+}
+
+#ifdef QTGAME_VECTOR_SSE2
+template <>
+inline double Vector2<double>::length() const {
+    __m128d v = _mm_loadu_pd(&x);
+    __m128d sq = _mm_mul_pd(v, v);
+    __m128d sum = _mm_add_sd(sq, _mm_unpackhi_pd(sq, sq));
+    return _mm_cvtsd_f64(_mm_sqrt_sd(sum, sum));
+}
+
+template <>
+inline Vector2<double>& Vector2<double>::addScaled(const Vector2& direction, double scale) {
+    __m128d v = _mm_loadu_pd(&x);
+    __m128d d = _mm_loadu_pd(&direction.x);
+    _mm_storeu_pd(&x, _mm_add_pd(v, _mm_mul_pd(d, _mm_set1_pd(scale))));
+    return *this;
+}
+
+// The float pair is loaded and stored per lane rather than through a double pointer,
+// which would alias the float members
+template <>
+inline float Vector2<float>::length() const {
+    __m128 v = _mm_set_ps(0.0f, 0.0f, y, x);
+    __m128 sq = _mm_mul_ps(v, v);
+    __m128 sum = _mm_add_ss(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(_mm_sqrt_ss(sum));
+}
+
+template <>
+inline Vector2<float>& Vector2<float>::addScaled(const Vector2& direction, float scale) {
+    __m128 v = _mm_set_ps(0.0f, 0.0f, y, x);
+    __m128 d = _mm_set_ps(0.0f, 0.0f, direction.y, direction.x);
+    __m128 r = _mm_add_ps(v, _mm_mul_ps(d, _mm_set1_ps(scale)));
+    x = _mm_cvtss_f32(r);
+    y = _mm_cvtss_f32(_mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 1, 1, 1)));
+    return *this;
+}
+#endif
+
+/**
+ * @brief Engine-wide scalar type
+ * 
+ * Selected at build time with the QTGAME_SCALAR CMake option; double by default.
+ */
+#if defined(QTGAME_SCALAR_FLOAT)
+using Scalar = float;
+#else
+using Scalar = double;
+#endif
+
+/**
+ * @brief Engine vector type
+ */
+using Vector2D = Vector2<Scalar>;
+
+#endif // VECTOR2D_H
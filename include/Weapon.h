@@ -1,6 +1,6 @@
 /**
  * @file Weapon.h
- * @brief Weapon system class definitions
+ * @brief Weapon system definitions
  * @author Justin0828
  * @date 2025-07-23
  */
@@ -10,11 +10,12 @@
 
 #include "Vector2D.h"
 #include "GameConfig.h"
-#include <memory>
-#include <QColor>
+#include "TimerWheel.h"
+#include <cstdint>
 
-// Forward declaration
+// Forward declarations
 class Player;
+struct BalanceConfig;
 
 /**
  * @brief Weapon type enumeration
@@ -37,170 +38,133 @@ enum class AmmoType {
 };
 
 /**
- * @brief Projectile class
- * 
- * Handles bullets, thrown objects and other moving attack projectiles
+ * @brief Get collision radius of a projectile
+ * @param type Ammunition type
+ * @return double Radius
  */
-class Projectile {
-public:
-    /**
-     * @brief Constructor
-     * @param startPos Starting position
-     * @param velocity Initial velocity
-     * @param damage Damage value
-     * @param type Ammunition type
-     * @param ownerId Owner ID
-     */
-    Projectile(const Vector2D& startPos, const Vector2D& velocity, int damage, AmmoType type, int ownerId);
+constexpr double getProjectileRadius(AmmoType type) {
+    return type == AmmoType::BULLET ? 3.0 : (type == AmmoType::THROWN ? 8.0 : 5.0);
+}
 
-    /**
-     * @brief Update projectile state
-     * @param deltaTime Time delta
-     */
-    void update(double deltaTime);
-
-    /**
-     * @brief Check if still valid
-     * @return bool Whether valid
-     */
-    bool isValid() const;
+/**
+ * @brief Launch parameters of a new projectile
+ */
+struct ProjectileLaunch {
+    Vector2D position;   ///< Starting position (center)
+    Vector2D velocity;   ///< Initial velocity
+    int damage;          ///< Damage value
+    AmmoType type;       ///< Ammunition type
+    int ownerId;         ///< Owner player index
+    std::uint32_t teamMask; ///< Owner team bit
+};
 
-    // Getter methods
-    Vector2D getPosition() const { return m_position; }
-    Vector2D getVelocity() const { return m_velocity; }
-    int getDamage() const { return m_damage; }
-    AmmoType getType() const { return m_type; }
-    int getOwnerId() const { return m_ownerId; }
-    double getRadius() const { return m_radius; }
-
-private:
-    Vector2D m_position;    ///< Position
-    Vector2D m_velocity;    ///< Velocity
-    int m_damage;           ///< Damage value
-    AmmoType m_type;        ///< Ammunition type
-    int m_ownerId;          ///< Owner ID
-    double m_radius;        ///< Radius
-    long long m_startTime;  ///< Creation time
-    static constexpr long long MAX_LIFETIME = 5000; ///< Maximum lifetime in milliseconds
+/**
+ * @brief Static per-type weapon parameters
+ */
+struct WeaponSpec {
+    int damage;              ///< Damage value
+    int cooldown;            ///< Attack cooldown time in milliseconds
+    int ammo;                ///< Initial ammunition (-1 means infinite)
+    double range;            ///< Attack range
+    AmmoType ammoType;       ///< Attack kind
+    double projectileSpeed;  ///< Projectile launch speed (0 for melee)
+    unsigned int color;      ///< Weapon color (0xRRGGBB)
+    int hitscan;             ///< Bullets hit instantly along a ray up to the range instead of flying (0/1)
 };
 
 /**
- * @brief Weapon base class
+ * @brief Weapon parameter table, indexed by WeaponType
  */
-class Weapon {
-public:
-    /**
-     * @brief Constructor
-     * @param type Weapon type
-     */
-    explicit Weapon(WeaponType type);
+constexpr WeaponSpec WEAPON_SPECS[] = {
+    // FIST
+    {GameConfig::FIST_DAMAGE, GameConfig::FIST_COOLDOWN, -1, 50.0, AmmoType::MELEE, 0.0, 0x8B4513, 0},    // Brown
+    // KNIFE
+    {GameConfig::KNIFE_DAMAGE, GameConfig::KNIFE_COOLDOWN, -1, 60.0, AmmoType::MELEE, 0.0, 0xC0C0C0, 0},  // Silver
+    // BALL
+    {GameConfig::BALL_DAMAGE, GameConfig::BALL_COOLDOWN, GameConfig::BALL_COUNT, 400.0,
+     AmmoType::THROWN, GameConfig::BALL_THROW_SPEED, 0xFFA500, 0},                                        // Orange
+    // RIFLE
+    {GameConfig::RIFLE_DAMAGE, GameConfig::RIFLE_COOLDOWN, GameConfig::RIFLE_AMMO, 600.0,
+     AmmoType::BULLET, GameConfig::BULLET_SPEED, 0x808080, 0},                                            // Gray
+    // SNIPER
+    {GameConfig::SNIPER_DAMAGE, GameConfig::SNIPER_COOLDOWN, GameConfig::SNIPER_AMMO, 800.0,
+     AmmoType::BULLET, GameConfig::BULLET_SPEED * 1.5, 0x404040, 0}                                       // Dark gray
+};
 
-    /**
-     * @brief Virtual destructor
-     */
-    virtual ~Weapon() = default;
+constexpr int WEAPON_TYPE_COUNT = sizeof(WEAPON_SPECS) / sizeof(WEAPON_SPECS[0]); ///< Number of weapon types
 
-    /**
-     * @brief Attack method
-     * @param player The attacker
-     * @param targetPos Target position
-     * @return std::shared_ptr<Projectile> Generated projectile (if any)
-     */
-    virtual std::shared_ptr<Projectile> attack(Player* player, const Vector2D& targetPos) = 0;
+/**
+ * @brief Look up weapon parameters
+ * @param type Weapon type
+ * @return const WeaponSpec& Parameters
+ */
+constexpr const WeaponSpec& getWeaponSpec(WeaponType type) {
+    return WEAPON_SPECS[static_cast<int>(type)];
+}
 
-    /**
-     * @brief Check if can attack
-     * @return bool Whether can attack
-     */
-    virtual bool canAttack() const;
+/**
+ * @brief Weapon state
+ * 
+ * Plain value held by the player; all per-type behavior comes from the spec it was created
+ * with, either WEAPON_SPECS or the weapon table of a BalanceConfig.
+ */
+struct WeaponState {
+    WeaponType type;           ///< Weapon type
+    int ammo;                  ///< Remaining ammunition (-1 means infinite)
+    TimerHandle cooldownTimer; ///< Pending cooldown timer (NO_TIMER when ready)
+    const WeaponSpec* spec;    ///< Parameters (outlives the weapon)
 
     /**
-     * @brief Update weapon state
-     * @param deltaTime Time delta
+     * @brief Create a freshly equipped weapon with the default parameters
+     * @param type Weapon type
+     * @return WeaponState Full ammunition, no cooldown
      */
-    virtual void update(double deltaTime);
+    static WeaponState create(WeaponType type);
 
     /**
-     * @brief Get attack range
-     * @return double Attack range
+     * @brief Create a freshly equipped weapon with overridden parameters
+     * @param type Weapon type
+     * @param balance Balance parameters (must outlive the weapon)
+     * @return WeaponState Full ammunition, no cooldown
      */
-    virtual double getAttackRange() const = 0;
-
-    // Getter methods
-    WeaponType getType() const { return m_type; }
-    int getAmmo() const { return m_ammo; }
-    int getDamage() const { return m_damage; }
-    QColor getColor() const { return m_color; }
-    bool hasAmmo() const { return m_ammo > 0 || m_ammo == -1; } // -1 means infinite ammo
+    static WeaponState create(WeaponType type, const BalanceConfig& balance);
 
-protected:
     /**
-     * @brief Consume ammunition
+     * @brief Check if can attack
+     * @return bool Whether ammunition is left and the cooldown has elapsed
      */
-    void consumeAmmo();
+    bool canAttack() const { return hasAmmo() && cooldownTimer == NO_TIMER; }
 
     /**
-     * @brief Reset attack cooldown
+     * @brief Start an attack, consuming ammunition and scheduling the end of the cooldown
+     * 
+     * The owner clears cooldownTimer when the WEAPON_READY event with this handle fires.
+     * @param timers Timer wheel of the engine
+     * @param owner Owner player index
+     * @return bool Whether the attack was allowed
      */
-    void resetCooldown();
-
-protected:
-    WeaponType m_type;        ///< Weapon type
-    int m_ammo;               ///< Ammunition count (-1 means infinite)
-    int m_damage;             ///< Damage value
-    int m_cooldown;           ///< Attack cooldown time in milliseconds
-    long long m_lastAttackTime; ///< Last attack time
-    QColor m_color;           ///< Weapon color
-};
-
-/**
- * @brief Fist weapon class
- */
-class FistWeapon : public Weapon {
-public:
-    FistWeapon();
-    std::shared_ptr<Projectile> attack(Player* player, const Vector2D& targetPos) override;
-    double getAttackRange() const override { return 50.0; }
-};
+    bool trigger(TimerWheel& timers, int owner);
 
-/**
- * @brief Knife weapon class
- */
-class KnifeWeapon : public Weapon {
-public:
-    KnifeWeapon();
-    std::shared_ptr<Projectile> attack(Player* player, const Vector2D& targetPos) override;
-    double getAttackRange() const override { return 60.0; }
-};
-
-/**
- * @brief Ball weapon class
- */
-class BallWeapon : public Weapon {
-public:
-    BallWeapon();
-    std::shared_ptr<Projectile> attack(Player* player, const Vector2D& targetPos) override;
-    double getAttackRange() const override { return 400.0; }
-};
-
-/**
- * @brief Rifle weapon class
- */
-class RifleWeapon : public Weapon {
-public:
-    RifleWeapon();
-    std::shared_ptr<Projectile> attack(Player* player, const Vector2D& targetPos) override;
-    double getAttackRange() const override { return 600.0; }
+    // Getter methods
+    const WeaponSpec& getSpec() const { return *spec; }
+    WeaponType getType() const { return type; }
+    int getAmmo() const { return ammo; }
+    int getDamage() const { return getSpec().damage; }
+    double getAttackRange() const { return getSpec().range; }
+    bool isMelee() const { return getSpec().ammoType == AmmoType::MELEE; }
+    unsigned int getColor() const { return getSpec().color; }
+    bool hasAmmo() const { return ammo > 0 || ammo == -1; } // -1 means infinite ammo
 };
 
 /**
- * @brief Sniper rifle weapon class
+ * @brief Compute the projectile for a ranged attack
+ * 
+ * The weapon must have been triggered already; melee weapons produce no projectile.
+ * @param weapon The weapon
+ * @param player The attacker
+ * @param launch Receives the launch parameters
+ * @return bool Whether a projectile is launched
  */
-class SniperWeapon : public Weapon {
-public:
-    SniperWeapon();
-    std::shared_ptr<Projectile> attack(Player* player, const Vector2D& targetPos) override;
-    double getAttackRange() const override { return 800.0; }
-};
+bool computeProjectileLaunch(const WeaponState& weapon, const Player& player, ProjectileLaunch& launch);
 
-#endif // WEAPON_H 
\ No newline at end of file
+#endif // WEAPON_H
\ No newline at end of file
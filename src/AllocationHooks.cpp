@@ -0,0 +1,35 @@
+/**
+ * @file AllocationHooks.cpp
+ * @brief Global operator new/delete replacements feeding AllocationTracker
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+#ifdef QTGAME_ALLOC_TRACKING
+
+// Linked only into executables: a shared library defining these would replace the allocator
+// of every process that loads it.
+// The array and nothrow forms forward to these by default. Over-aligned allocations
+// (operator new with std::align_val_t) keep the library implementation and are not counted.
+void* operator new(std::size_t size) {
+    AllocationTracker::recordAllocation(size);
+    void* pointer = std::malloc(size > 0 ? size : 1);
+    if (!pointer) throw std::bad_alloc();
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) return;
+    AllocationTracker::recordDeallocation();
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    ::operator delete(pointer);
+}
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file AllocationTracker.cpp
+ * @brief Heap allocation tracker implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "AllocationTracker.h"
+#include <QFile>
+#include <QTextStream>
+#include <algorithm>
+#include <atomic>
+
+namespace {
+    constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(AllocationPhase::COUNT);
+    
+    // Zero-initialized before any constructor runs, so allocations during static
+    // initialization are counted safely
+    std::atomic<std::uint64_t> g_allocations[PHASE_COUNT];
+    std::atomic<std::uint64_t> g_bytes[PHASE_COUNT];
+    std::atomic<std::uint64_t> g_deallocations[PHASE_COUNT];
+    
+    thread_local AllocationPhase t_phase = AllocationPhase::OTHER;
+    
+    const char* const PHASE_NAMES[PHASE_COUNT] = {
+        "other",
+        "tick_timers", "tick_input", "tick_bots", "tick_streaming", "tick_player_movement",
+        "tick_integration", "tick_player_contacts", "tick_projectiles", "tick_items", "tick_bounds",
+        "tick_player_hot_state", "tick_hits", "tick_flush", "tick_game_over",
+        "render_world", "render_hud"
+    };
+}
+
+AllocationPhase AllocationTracker::enter(AllocationPhase phase) {
+    AllocationPhase previous = t_phase;
+    t_phase = phase;
+    return previous;
+}
+
+AllocationPhase AllocationTracker::getPhase() {
+    return t_phase;
+}
+
+void AllocationTracker::recordAllocation(std::size_t bytes) {
+    std::size_t phase = static_cast<std::size_t>(t_phase);
+    g_allocations[phase].fetch_add(1, std::memory_order_relaxed);
+    g_bytes[phase].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void AllocationTracker::recordDeallocation() {
+    g_deallocations[static_cast<std::size_t>(t_phase)].fetch_add(1, std::memory_order_relaxed);
+}
+
+AllocationSnapshot AllocationTracker::snapshot() {
+    AllocationSnapshot counts;
+    for (std::size_t i = 0; i < PHASE_COUNT; ++i) {
+        counts[i] = AllocationCounts{g_allocations[i].load(std::memory_order_relaxed),
+                                     g_bytes[i].load(std::memory_order_relaxed),
+                                     g_deallocations[i].load(std::memory_order_relaxed)};
+    }
+    return counts;
+}
+
+AllocationSnapshot AllocationTracker::difference(const AllocationSnapshot& before, const AllocationSnapshot& after) {
+    AllocationSnapshot counts;
+    for (std::size_t i = 0; i < PHASE_COUNT; ++i) {
+        counts[i] = AllocationCounts{after[i].allocations - before[i].allocations,
+                                     after[i].bytes - before[i].bytes,
+                                     after[i].deallocations - before[i].deallocations};
+    }
+    return counts;
+}
+
+AllocationCounts AllocationTracker::sum(const AllocationSnapshot& counts, AllocationPhase first, AllocationPhase last) {
+    AllocationCounts total{0, 0, 0};
+    for (std::size_t i = static_cast<std::size_t>(first); i <= static_cast<std::size_t>(last); ++i) {
+        total.allocations += counts[i].allocations;
+        total.bytes += counts[i].bytes;
+        total.deallocations += counts[i].deallocations;
+    }
+    return total;
+}
+
+const char* AllocationTracker::getPhaseName(AllocationPhase phase) {
+    return phase < AllocationPhase::COUNT ? PHASE_NAMES[static_cast<std::size_t>(phase)] : "unknown";
+}
+
+AllocationTrace::AllocationTrace()
+    : m_frames(CAPACITY), m_previous(AllocationTracker::snapshot()), m_lastFrame(), m_frameCount(0) {
+}
+
+void AllocationTrace::recordFrame() {
+    AllocationSnapshot now = AllocationTracker::snapshot();
+    m_lastFrame = AllocationTracker::difference(m_previous, now);
+    m_previous = now;
+    m_frames[m_frameCount % CAPACITY] = m_lastFrame;
+    m_frameCount++;
+}
+
+bool AllocationTrace::exportTrace(const QString& path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        return false;
+    }
+    
+    QTextStream out(&file);
+    out << "# QtGame heap allocations per frame (allocations, bytes and deallocations per phase)\n";
+    out << "frame";
+    for (std::size_t i = 0; i < PHASE_COUNT; ++i) {
+        const char* name = AllocationTracker::getPhaseName(static_cast<AllocationPhase>(i));
+        out << "," << name << "_allocs," << name << "_bytes," << name << "_frees";
+    }
+    out << "\n";
+    
+    // Oldest kept frame first
+    long long first = std::max(0LL, m_frameCount - CAPACITY);
+    for (long long frame = first; frame < m_frameCount; ++frame) {
+        const AllocationSnapshot& counts = m_frames[frame % CAPACITY];
+        out << frame;
+        for (const AllocationCounts& phase : counts) {
+            out << "," << phase.allocations << "," << phase.bytes << "," << phase.deallocations;
+        }
+        out << "\n";
+    }
+    
+    return true;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file BalanceConfig.cpp
+ * @brief Runtime balance parameter overlay implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "BalanceConfig.h"
+#include <QStringList>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+BalanceConfig::BalanceConfig()
+    : bandageHeal(GameConfig::BANDAGE_HEAL), medkitHeal(GameConfig::MEDKIT_HEAL),
+      adrenalineHeal(GameConfig::ADRENALINE_HEAL), adrenalineDuration(GameConfig::ADRENALINE_DURATION),
+      adrenalineSpeedMultiplier(GameConfig::ADRENALINE_SPEED_MULTIPLIER),
+      itemDropInterval(GameConfig::ITEM_DROP_INTERVAL) {
+    for (int i = 0; i < WEAPON_TYPE_COUNT; ++i) {
+        weapons[i] = WEAPON_SPECS[i];
+    }
+}
+
+const BalanceConfig& BalanceConfig::defaults() {
+    static const BalanceConfig config;
+    return config;
+}
+
+bool BalanceConfig::set(const QString& name, double value, QString* error) {
+    bool found = false;
+    bool valid = false;
+    visitParameters([&](const char* parameter, auto& field, double min, double max) {
+        if (found || name != QString(parameter)) return;
+        found = true;
+        
+        // Checked before the conversion, which is undefined for values an int cannot hold
+        if (!std::isfinite(value) || value < min || value > max) {
+            if (error) {
+                *error = max == std::numeric_limits<double>::max()
+                             ? QString("%1 must be a finite number of at least %2: %3").arg(name).arg(min).arg(value)
+                             : QString("%1 must be between %2 and %3: %4").arg(name).arg(min).arg(max).arg(value);
+            }
+            return;
+        }
+        using Field = std::remove_reference_t<decltype(field)>;
+        if (std::is_integral<Field>::value) {
+            field = static_cast<Field>(std::lround(value));
+        } else {
+            field = static_cast<Field>(value);
+        }
+        valid = true;
+    });
+    if (!found && error) *error = QString("Unknown parameter: %1").arg(name);
+    return valid;
+}
+
+bool BalanceConfig::parse(const QString& text, QString* error) {
+    for (const QString& assignment : text.split(',', Qt::SkipEmptyParts)) {
+        QStringList parts = assignment.split('=');
+        bool ok = parts.size() == 2;
+        double value = ok ? parts[1].trimmed().toDouble(&ok) : 0.0;
+        
+        if (!ok) {
+            if (error) *error = QString("Malformed assignment: %1").arg(assignment);
+            return false;
+        }
+        if (!set(parts[0].trimmed(), value, error)) return false;
+    }
+    return true;
+}
@@ -0,0 +1,166 @@
+/**
+ * @file BotController.cpp
+ * @brief Scripted bot controller implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "BotController.h"
+#include "GameConfig.h"
+#include <cmath>
+
+namespace {
+    constexpr ActionMask ALL_ACTIONS = Action::LEFT | Action::RIGHT | Action::JUMP | Action::CROUCH | Action::FIRE;
+    constexpr double STUCK_SPEED = 1.0;      ///< Horizontal speed below which a walking bot counts as blocked
+    constexpr double CLIMB_HEIGHT = 60.0;    ///< Height difference at which a bot jumps towards a target
+    
+    /**
+     * @brief Walk towards a target, jumping when it is above or the way is blocked
+     * @param observation Current observation
+     * @param target Target position
+     * @param stopDistance Horizontal distance at which to stop walking
+     * @param last Actions held last tick
+     * @return ActionMask Movement actions
+     */
+    ActionMask approach(const BotObservation& observation, const Vector2D& target, double stopDistance,
+                        ActionMask last) {
+        ActionMask actions = Action::NONE;
+        double dx = target.x - observation.position.x;
+        double dy = target.y - observation.position.y;
+        
+        if (std::abs(dx) > stopDistance) {
+            actions |= dx < 0 ? Action::LEFT : Action::RIGHT;
+        } else if ((dx < 0) == observation.facingRight && dx != 0) {
+            // Step once to turn around
+            actions |= dx < 0 ? Action::LEFT : Action::RIGHT;
+        }
+        
+        // Jump is a press edge: release it for one tick before pressing again
+        bool blocked = (actions & last & (Action::LEFT | Action::RIGHT)) && std::abs(observation.velocity.x) < STUCK_SPEED;
+        if (observation.grounded && !(last & Action::JUMP) && (dy < -CLIMB_HEIGHT || blocked)) {
+            actions |= Action::JUMP;
+        }
+        return actions;
+    }
+}
+
+// ======================== AggressiveBot implementation ========================
+
+ActionMask AggressiveBot::decide(const BotObservation& observation) {
+    ActionMask actions = Action::NONE;
+    
+    if (observation.hasOpponent) {
+        // Melee weapons close in, ranged weapons keep half their range
+        double stopDistance = observation.melee ? GameConfig::PLAYER_WIDTH * 0.5 : observation.attackRange * 0.5;
+        actions = approach(observation, observation.opponentPosition, stopDistance, m_last);
+        
+        // Bullets fly level, so ranged weapons only fire at roughly the same height
+        double dx = observation.opponentPosition.x - observation.position.x;
+        double dy = observation.opponentPosition.y - observation.position.y;
+        // Direction keys are applied before fire, so a turning step already faces the target
+        bool facingRight = (actions & Action::RIGHT) ? true : (actions & Action::LEFT) ? false : observation.facingRight;
+        bool facing = (dx >= 0) == facingRight;
+        bool aligned = observation.melee || std::abs(dy) < GameConfig::PLAYER_HEIGHT;
+        
+        if (observation.canAttack && facing && aligned && observation.opponentDistance <= observation.attackRange &&
+            !(m_last & Action::FIRE)) {
+            actions |= Action::FIRE;
+        }
+    }
+    
+    m_last = actions;
+    return actions;
+}
+
+void AggressiveBot::saveState(StateWriter& writer) const {
+    writer.write(m_last);
+}
+
+bool AggressiveBot::restoreState(StateReader& reader) {
+    return reader.read(m_last) && (m_last & ~ALL_ACTIONS) == 0;
+}
+
+// ======================== ItemCollectorBot implementation ========================
+
+ActionMask ItemCollectorBot::decide(const BotObservation& observation) {
+    if (!observation.hasItem) {
+        m_last = m_fallback.decide(observation);
+        return m_last;
+    }
+    
+    ActionMask actions = approach(observation, observation.itemPosition, GameConfig::PLAYER_WIDTH * 0.5, m_last);
+    
+    // Still fire at opponents that come into range on the way
+    actions |= m_fallback.decide(observation) & Action::FIRE;
+    
+    // Crouch next to the item to pick it up, then stand again to move on
+    if (observation.grounded && observation.itemDistance < GameConfig::PLAYER_HEIGHT && !(m_last & Action::CROUCH)) {
+        actions = Action::CROUCH;
+    }
+    
+    m_last = actions;
+    return actions;
+}
+
+void ItemCollectorBot::saveState(StateWriter& writer) const {
+    m_fallback.saveState(writer);
+    writer.write(m_last);
+}
+
+bool ItemCollectorBot::restoreState(StateReader& reader) {
+    return m_fallback.restoreState(reader) && reader.read(m_last) && (m_last & ~ALL_ACTIONS) == 0;
+}
+
+// ======================== RandomBot implementation ========================
+
+RandomBot::RandomBot(std::uint64_t seed, std::uint64_t stream) : m_random(seed, stream, RandomPurpose::BOT) {
+}
+
+ActionMask RandomBot::decide(const BotObservation& observation) {
+    if (--m_holdTicks <= 0) {
+        m_current = static_cast<ActionMask>(m_random.nextBelow(32));
+        m_holdTicks = m_random.nextInt(5, MAX_HOLD_TICKS);
+    }
+    return m_current;
+}
+
+void RandomBot::saveState(StateWriter& writer) const {
+    writer.write(m_random);
+    writer.write(m_current);
+    writer.write(m_holdTicks);
+}
+
+bool RandomBot::restoreState(StateReader& reader) {
+    reader.read(m_random);
+    reader.read(m_current);
+    reader.read(m_holdTicks);
+    // decide() counts the hold down, so it must stay within the range it chose from
+    return reader.isValid() && (m_current & ~ALL_ACTIONS) == 0 && m_holdTicks >= 0 && m_holdTicks <= MAX_HOLD_TICKS;
+}
+
+// ======================== Bot factory ========================
+
+std::unique_ptr<BotController> createBot(BotType type, std::uint64_t seed, std::uint64_t stream) {
+    switch (type) {
+        case BotType::AGGRESSIVE:
+            return std::make_unique<AggressiveBot>();
+        case BotType::ITEM_COLLECTOR:
+            return std::make_unique<ItemCollectorBot>();
+        case BotType::RANDOM:
+            return std::make_unique<RandomBot>(seed, stream);
+    }
+    return nullptr;
+}
+
+bool parseBotType(const QString& name, BotType& type) {
+    if (name == QStringLiteral("aggressive")) {
+        type = BotType::AGGRESSIVE;
+    } else if (name == QStringLiteral("collector")) {
+        type = BotType::ITEM_COLLECTOR;
+    } else if (name == QStringLiteral("random")) {
+        type = BotType::RANDOM;
+    } else {
+        return false;
+    }
+    return true;
+}
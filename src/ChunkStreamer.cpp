@@ -0,0 +1,347 @@
+/**
+ * @file ChunkStreamer.cpp
+ * @brief Chunk streamer class implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "ChunkStreamer.h"
+#include <iterator>
+
+ChunkStreamer::ChunkStreamer(const Level& level) : m_level(level) {
+    reset();
+}
+
+void ChunkStreamer::reset() {
+    m_residentChunks.clear();
+    m_rejectedChunks.clear();
+    m_activePlatforms.clear();
+    m_active.assign(m_level.getPlatformCount(), ActiveEntry{0, 0});
+    
+    // Every list is bounded by the chunk or platform count, so streaming never allocates
+    std::size_t chunkCount = static_cast<std::size_t>(m_level.getChunkColumns()) * m_level.getChunkRows();
+    m_residentChunks.reserve(chunkCount);
+    m_wantedChunks.reserve(chunkCount);
+    m_rejectedChunks.reserve(chunkCount);
+    m_wantedMarks.assign(chunkCount, 0);
+    m_activePlatforms.reserve(m_level.getPlatformCount());
+}
+
+bool ChunkStreamer::update(const std::vector<StreamRegion>& regions) {
+    // Collect chunks overlapping any region
+    m_wantedChunks.clear();
+    double chunkSize = m_level.getChunkSize();
+    int lastColumn = static_cast<int>(m_level.getChunkColumns()) - 1;
+    int lastRow = static_cast<int>(m_level.getChunkRows()) - 1;
+    
+    for (const StreamRegion& region : regions) {
+        int minX = std::clamp(static_cast<int>(std::floor(region.min.x / chunkSize)), 0, lastColumn);
+        int maxX = std::clamp(static_cast<int>(std::floor(region.max.x / chunkSize)), 0, lastColumn);
+        int minY = std::clamp(static_cast<int>(std::floor(region.min.y / chunkSize)), 0, lastRow);
+        int maxY = std::clamp(static_cast<int>(std::floor(region.max.y / chunkSize)), 0, lastRow);
+        
+        for (int cy = minY; cy <= maxY; ++cy) {
+            for (int cx = minX; cx <= maxX; ++cx) {
+                // Overlapping regions list a chunk once
+                std::uint32_t chunk = static_cast<std::uint32_t>(cy) * m_level.getChunkColumns() + cx;
+                if (m_wantedMarks[chunk]) continue;
+                m_wantedMarks[chunk] = 1;
+                m_wantedChunks.push_back(chunk);
+            }
+        }
+    }
+    for (std::uint32_t chunk : m_wantedChunks) {
+        m_wantedMarks[chunk] = 0;
+    }
+    std::sort(m_wantedChunks.begin(), m_wantedChunks.end());
+    
+    if (m_wantedChunks == m_residentChunks) return false;
+    
+    // Walk both sorted lists: evict chunks no longer wanted, load new ones
+    bool changed = false;
+    auto resident = m_residentChunks.begin();
+    auto wanted = m_wantedChunks.begin();
+    while (resident != m_residentChunks.end() || wanted != m_wantedChunks.end()) {
+        if (wanted == m_wantedChunks.end() || (resident != m_residentChunks.end() && *resident < *wanted)) {
+            changed |= evictChunk(*resident++);
+        } else if (resident == m_residentChunks.end() || *wanted < *resident) {
+            changed |= loadChunk(*wanted++);
+        } else {
+            ++resident;
+            ++wanted;
+        }
+    }
+    
+    // Rejected chunks never become resident
+    m_residentChunks.clear();
+    std::set_difference(m_wantedChunks.begin(), m_wantedChunks.end(),
+                        m_rejectedChunks.begin(), m_rejectedChunks.end(),
+                        std::back_inserter(m_residentChunks));
+    
+    return changed;
+}
+
+bool ChunkStreamer::isResident(const Vector2D& point) const {
+    double chunkSize = m_level.getChunkSize();
+    int cx = std::clamp(static_cast<int>(std::floor(point.x / chunkSize)), 0, static_cast<int>(m_level.getChunkColumns()) - 1);
+    int cy = std::clamp(static_cast<int>(std::floor(point.y / chunkSize)), 0, static_cast<int>(m_level.getChunkRows()) - 1);
+    
+    return isChunkResident(static_cast<std::uint32_t>(cy) * m_level.getChunkColumns() + cx);
+}
+
+std::int32_t ChunkStreamer::findSurface(double minX, double maxX, double minTop, double maxTop) const {
+    double chunkSize = m_level.getChunkSize();
+    int perChunk = static_cast<int>(m_level.getColumnsPerChunk());
+    double columnSize = chunkSize / perChunk;
+    int lastColumn = static_cast<int>(m_level.getChunkColumns()) * perChunk - 1;
+    int lastRow = static_cast<int>(m_level.getChunkRows()) - 1;
+    int minColumn = std::clamp(static_cast<int>(std::floor(minX / columnSize)), 0, lastColumn);
+    int maxColumn = std::clamp(static_cast<int>(std::floor(maxX / columnSize)), 0, lastColumn);
+    int minRow = std::clamp(static_cast<int>(std::floor(minTop / chunkSize)), 0, lastRow);
+    int maxRow = std::clamp(static_cast<int>(std::floor(maxTop / chunkSize)), 0, lastRow);
+    
+    std::int32_t best = -1;
+    double bestTop = 0.0;
+    for (int row = minRow; row <= maxRow; ++row) {
+        for (int column = minColumn; column <= maxColumn; ++column) {
+            std::uint32_t chunk = static_cast<std::uint32_t>(row) * m_level.getChunkColumns() + column / perChunk;
+            if (!isChunkResident(chunk)) continue;
+            
+            // First surface at or below minTop, then down the column while inside the band
+            const LevelFormat::SurfaceColumn& record = m_level.getChunkSurfaceColumns(chunk)[column % perChunk];
+            std::uint32_t first = record.first;
+            std::uint32_t count = record.count;
+            while (count > 0) {
+                std::uint32_t half = count / 2;
+                if (m_level.getSurface(first + half).top < minTop) {
+                    first += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            
+            for (std::uint32_t i = first; i < record.first + record.count; ++i) {
+                const LevelFormat::SurfaceRecord& surface = m_level.getSurface(i);
+                if (surface.top > maxTop || (best >= 0 && surface.top > bestTop)) break;
+                if (surface.left >= maxX || surface.right <= minX) continue;
+                
+                std::int32_t platform = static_cast<std::int32_t>(surface.platform);
+                if (best < 0 || surface.top < bestTop || platform < best) {
+                    best = platform;
+                    bestTop = surface.top;
+                }
+                break;
+            }
+        }
+    }
+    return best;
+}
+
+bool ChunkStreamer::raycastPlatforms(const Vector2D& origin, const Vector2D& direction, double maxDistance,
+                                     double radius, RayHit& hit) const {
+    double cellSize = m_level.getChunkSize() / m_level.getCellsPerChunk();
+    Vector2D grow(radius, radius);
+    
+    // Grid traversal: distances at which the ray crosses the next vertical and horizontal
+    // cell borders, and the distance between two borders
+    double borderX = (std::floor(origin.x / cellSize) + (direction.x > 0 ? 1 : 0)) * cellSize;
+    double borderY = (std::floor(origin.y / cellSize) + (direction.y > 0 ? 1 : 0)) * cellSize;
+    double nextX = direction.x != 0 ? (borderX - origin.x) / direction.x : maxDistance;
+    double nextY = direction.y != 0 ? (borderY - origin.y) / direction.y : maxDistance;
+    double deltaX = direction.x != 0 ? cellSize / std::abs(direction.x) : maxDistance;
+    double deltaY = direction.y != 0 ? cellSize / std::abs(direction.y) : maxDistance;
+    
+    bool found = false;
+    double segmentStart = 0.0;
+    while (segmentStart <= maxDistance) {
+        double segmentEnd = std::min(std::min(nextX, nextY), maxDistance);
+        
+        // Platforms whose grown box can meet this segment share a cell with its grown bounds
+        Vector2D start = origin + direction * segmentStart;
+        Vector2D end = origin + direction * segmentEnd;
+        Vector2D boundsMin(std::min(start.x, end.x), std::min(start.y, end.y));
+        Vector2D boundsMax(std::max(start.x, end.x), std::max(start.y, end.y));
+        queryPlatforms(boundsMin - grow, boundsMax + grow, [&](std::uint32_t index) {
+            const LevelFormat::PlatformRecord& platform = m_level.getPlatform(index);
+            Vector2D platformMin(platform.x, platform.y);
+            Vector2D platformMax(platform.x + platform.width, platform.y + platform.height);
+            double distance = 0.0;
+            Vector2D normal;
+            if (!intersectCircleCastBox(origin, direction, radius, platformMin, platformMax,
+                                        found ? hit.distance : maxDistance, distance, normal)) {
+                return false;
+            }
+            
+            std::int32_t platformIndex = static_cast<std::int32_t>(index);
+            if (!found || distance < hit.distance || (distance == hit.distance && platformIndex < hit.platform)) {
+                hit.distance = distance;
+                hit.normal = normal;
+                hit.platform = platformIndex;
+                hit.player = -1;
+                found = true;
+            }
+            return false;
+        });
+        
+        // Nothing later along the ray can be nearer than a hit inside this segment
+        if ((found && hit.distance <= segmentEnd) || segmentEnd >= maxDistance) break;
+        
+        segmentStart = segmentEnd;
+        if (nextX < nextY) {
+            nextX += deltaX;
+        } else {
+            nextY += deltaY;
+        }
+    }
+    
+    if (found) {
+        hit.point = origin + direction * hit.distance;
+    }
+    return found;
+}
+
+bool ChunkStreamer::predictImpact(const Vector2D& origin, const Vector2D& velocity, double accelerationY,
+                                  double radius, double maxTime, double& time, std::int32_t& platform) const {
+    double speed = velocity.length();
+    if (accelerationY == 0.0) {
+        RayHit hit;
+        if (speed == 0.0 || !raycastPlatforms(origin, velocity / speed, speed * maxTime, radius, hit)) return false;
+        time = hit.distance / speed;
+        platform = hit.platform;
+        return true;
+    }
+    
+    // Chords short enough that the parabola strays less than CHORD_ERROR from them, and that
+    // |v| * t + |a| * t^2 / 2 stays below about a cell
+    const double CHORD_ERROR = 0.01;
+    double cellSize = m_level.getChunkSize() / m_level.getCellsPerChunk();
+    double chordTime = std::sqrt(8.0 * CHORD_ERROR / std::abs(accelerationY));
+    double accelerationStep = std::sqrt(std::abs(accelerationY) * cellSize);
+    auto positionAt = [&](double t) {
+        return Vector2D(origin.x + velocity.x * t, origin.y + (velocity.y + 0.5 * accelerationY * t) * t);
+    };
+    
+    double chordStart = 0.0;
+    Vector2D start = origin;
+    while (chordStart < maxTime) {
+        double chordSpeed = std::hypot(velocity.x, velocity.y + accelerationY * chordStart);
+        double chordEnd = std::min(maxTime, chordStart + std::min(chordTime, cellSize / (chordSpeed + accelerationStep)));
+        Vector2D end = positionAt(chordEnd);
+        
+        // The chord is cast as a ray, its distances map linearly back to time
+        Vector2D chord = end - start;
+        double length = chord.length();
+        RayHit hit;
+        Vector2D direction = length > 0.0 ? chord / length : Vector2D();
+        if (raycastPlatforms(start, direction, length, radius, hit)) {
+            time = length > 0.0 ? chordStart + (chordEnd - chordStart) * hit.distance / length : chordStart;
+            platform = hit.platform;
+            return true;
+        }
+        chordStart = chordEnd;
+        start = end;
+    }
+    return false;
+}
+
+bool ChunkStreamer::isChunkResident(std::uint32_t chunk) const {
+    return std::binary_search(m_residentChunks.begin(), m_residentChunks.end(), chunk);
+}
+
+bool ChunkStreamer::loadChunk(std::uint32_t chunk) {
+    if (std::binary_search(m_rejectedChunks.begin(), m_rejectedChunks.end(), chunk)) return false;
+    
+    if (!m_level.isChunkValid(chunk)) {
+        m_rejectedChunks.insert(std::upper_bound(m_rejectedChunks.begin(), m_rejectedChunks.end(), chunk), chunk);
+        return false;
+    }
+    
+    bool added = false;
+    const LevelFormat::ChunkRecord& record = m_level.getChunk(chunk);
+    for (std::uint32_t i = 0; i < record.count; ++i) {
+        std::uint32_t platform = m_level.getIndex(record.first + i);
+        ActiveEntry& entry = m_active[platform];
+        if (entry.references++ == 0) {
+            entry.slot = m_activePlatforms.size();
+            m_activePlatforms.push_back(platform);
+            added = true;
+        }
+    }
+    return added;
+}
+
+bool ChunkStreamer::evictChunk(std::uint32_t chunk) {
+    bool removed = false;
+    const LevelFormat::ChunkRecord& record = m_level.getChunk(chunk);
+    for (std::uint32_t i = 0; i < record.count; ++i) {
+        std::uint32_t platform = m_level.getIndex(record.first + i);
+        ActiveEntry& entry = m_active[platform];
+        if (entry.references == 0 || --entry.references > 0) continue;
+        
+        // Swap-remove from the active list
+        std::uint32_t moved = m_activePlatforms.back();
+        m_activePlatforms[entry.slot] = moved;
+        m_activePlatforms.pop_back();
+        m_active[moved].slot = entry.slot;
+        removed = true;
+    }
+    return removed;
+}
+
+void ChunkStreamer::saveState(StateWriter& writer) const {
+    writer.writeVector(m_residentChunks);
+    writer.writeVector(m_activePlatforms);
+    writer.writeVector(m_active);
+    writer.writeVector(m_rejectedChunks);
+}
+
+bool ChunkStreamer::restoreState(StateReader& reader) {
+    if (!reader.readVector(m_residentChunks) || !reader.readVector(m_activePlatforms) ||
+        !reader.readVector(m_active) || !reader.readVector(m_rejectedChunks) ||
+        m_active.size() != m_level.getPlatformCount()) {
+        return false;
+    }
+    
+    // Chunk lists are sorted and name chunks of this level; resident chunks are evicted later,
+    // so they must be valid ones
+    std::size_t chunkCount = static_cast<std::size_t>(m_level.getChunkColumns()) * m_level.getChunkRows();
+    auto isSortedChunkList = [chunkCount](const std::vector<std::uint32_t>& chunks) {
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            if (chunks[i] >= chunkCount || (i > 0 && chunks[i - 1] >= chunks[i])) return false;
+        }
+        return true;
+    };
+    if (!isSortedChunkList(m_residentChunks) || !isSortedChunkList(m_rejectedChunks)) return false;
+    
+    // Reference counts must be those of the resident chunks, and the active list must hold
+    // exactly the referenced platforms at their recorded slots. The counts are taken down and
+    // put back in place, so restoring does not allocate
+    for (std::uint32_t chunk : m_residentChunks) {
+        if (!m_level.isChunkValid(chunk)) return false;
+    }
+    auto addReferences = [this](int delta) {
+        for (std::uint32_t chunk : m_residentChunks) {
+            const LevelFormat::ChunkRecord& record = m_level.getChunk(chunk);
+            for (std::uint32_t i = 0; i < record.count; ++i) {
+                m_active[m_level.getIndex(record.first + i)].references += delta;
+            }
+        }
+    };
+    addReferences(-1);
+    bool balanced = std::all_of(m_active.begin(), m_active.end(), [](const ActiveEntry& entry) {
+        return entry.references == 0;
+    });
+    addReferences(1);
+    if (!balanced) return false;
+    
+    std::size_t referenced = std::count_if(m_active.begin(), m_active.end(), [](const ActiveEntry& entry) {
+        return entry.references > 0;
+    });
+    if (referenced != m_activePlatforms.size()) return false;
+    for (std::size_t i = 0; i < m_activePlatforms.size(); ++i) {
+        std::uint32_t platform = m_activePlatforms[i];
+        if (platform >= m_active.size() || m_active[platform].references == 0 || m_active[platform].slot != i) return false;
+    }
+    return true;
+}
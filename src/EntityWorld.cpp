@@ -0,0 +1,222 @@
+/**
+ * @file EntityWorld.cpp
+ * @brief Entity-component storage implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "EntityWorld.h"
+#include "GameConfig.h"
+#include <cstring>
+
+EntityWorld::EntityWorld() {
+}
+
+Entity EntityWorld::create() {
+    Entity entity;
+    if (!m_freeIds.empty()) {
+        entity = m_freeIds.back();
+        m_freeIds.pop_back();
+    } else {
+        entity = static_cast<Entity>(m_slots.size());
+        m_slots.push_back(SlotState::FREE);
+    }
+    
+    m_slots[entity] = SlotState::ALIVE;
+    return entity;
+}
+
+void EntityWorld::destroy(Entity entity) {
+    if (!isAlive(entity)) return;
+    
+    m_slots[entity] = SlotState::DYING;
+    m_destroyQueue.push_back(entity);
+}
+
+void EntityWorld::flushDestroyed() {
+    for (Entity entity : m_destroyQueue) {
+        motions.remove(entity);
+        bodies.remove(entity);
+        bounds.remove(entity);
+        gravities.remove(entity);
+        lifetimes.remove(entity);
+        sprites.remove(entity);
+        projectiles.remove(entity);
+        items.remove(entity);
+        
+        m_slots[entity] = SlotState::FREE;
+        m_freeIds.push_back(entity);
+    }
+    m_destroyQueue.clear();
+}
+
+void EntityWorld::clear() {
+    motions.clear();
+    bodies.clear();
+    bounds.clear();
+    gravities.clear();
+    lifetimes.clear();
+    sprites.clear();
+    projectiles.clear();
+    items.clear();
+    
+    m_slots.clear();
+    m_freeIds.clear();
+    m_destroyQueue.clear();
+}
+
+void EntityWorld::reserve(std::size_t capacity) {
+    motions.reserve(capacity);
+    bodies.reserve(capacity);
+    bounds.reserve(capacity);
+    gravities.reserve(capacity);
+    lifetimes.reserve(capacity);
+    sprites.reserve(capacity);
+    projectiles.reserve(capacity);
+    items.reserve(capacity);
+    
+    m_slots.reserve(capacity);
+    m_freeIds.reserve(capacity);
+    m_destroyQueue.reserve(capacity);
+}
+
+bool EntityWorld::isAlive(Entity entity) const {
+    return entity < m_slots.size() && m_slots[entity] == SlotState::ALIVE;
+}
+
+void EntityWorld::sleep(Entity entity) {
+    Bounds* box = bounds.find(entity);
+    const Motion* motion = motions.find(entity);
+    const Body* body = bodies.find(entity);
+    if (box && motion && body) {
+        box->min = motion->position + body->offset;
+        box->max = box->min + body->size;
+    }
+    
+    motions.setAwake(entity, false);
+    bounds.setAwake(entity, false);
+    gravities.setAwake(entity, false);
+    items.setAwake(entity, false);
+}
+
+void EntityWorld::wake(Entity entity) {
+    motions.setAwake(entity, true);
+    bounds.setAwake(entity, true);
+    gravities.setAwake(entity, true);
+    items.setAwake(entity, true);
+}
+
+void EntityWorld::integrate(double deltaTime) {
+    applyGravity(deltaTime, 0, gravities.awakeSize());
+    advanceMotions(deltaTime, 0, motions.awakeSize());
+}
+
+void EntityWorld::applyGravity(double deltaTime, std::size_t begin, std::size_t end) {
+    // Apply gravity to everything airborne
+    for (std::size_t i = begin; i < end; ++i) {
+        const Gravity& gravity = gravities.at(i);
+        if (gravity.grounded) continue;
+        
+        Motion* motion = motions.find(gravities.entityAt(i));
+        if (motion) {
+            motion->velocity.y += GameConfig::GRAVITY * gravity.scale * deltaTime;
+        }
+    }
+}
+
+void EntityWorld::advanceMotions(double deltaTime, std::size_t begin, std::size_t end) {
+    // Update positions of awake entities
+    for (std::size_t i = begin; i < end; ++i) {
+        Motion& motion = motions.at(i);
+        motion.position.addScaled(motion.velocity, deltaTime);
+    }
+}
+
+void EntityWorld::updateBounds() {
+    updateBounds(0, bounds.awakeSize());
+}
+
+void EntityWorld::updateBounds(std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        Entity entity = bounds.entityAt(i);
+        const Motion* motion = motions.find(entity);
+        const Body* body = bodies.find(entity);
+        if (!motion || !body) continue;
+        
+        Bounds& box = bounds.at(i);
+        box.min = motion->position + body->offset;
+        box.max = box.min + body->size;
+    }
+}
+
+void EntityWorld::saveState(StateWriter& writer) const {
+    writer.writeVector(m_slots);
+    writer.writeVector(m_freeIds);
+    writer.writeVector(m_destroyQueue);
+    motions.saveState(writer);
+    bodies.saveState(writer);
+    bounds.saveState(writer);
+    gravities.saveState(writer);
+    lifetimes.saveState(writer);
+    sprites.saveState(writer);
+    projectiles.saveState(writer);
+    items.saveState(writer);
+}
+
+bool EntityWorld::restoreState(StateReader& reader) {
+    if (!reader.readVector(m_slots) || !reader.readVector(m_freeIds) || !reader.readVector(m_destroyQueue)) {
+        return false;
+    }
+    
+    // Every free id must be listed once for recycling and every dying one queued once, or
+    // creating and flushing corrupt the slots. Listed slots are marked in place, so restoring
+    // does not allocate
+    constexpr std::uint8_t LISTED = 0x80;
+    auto markListed = [this](const std::vector<Entity>& ids, SlotState state) {
+        for (Entity entity : ids) {
+            if (entity >= m_slots.size() || m_slots[entity] != state) return false;
+            m_slots[entity] = static_cast<SlotState>(static_cast<std::uint8_t>(state) | LISTED);
+        }
+        return true;
+    };
+    bool listed = markListed(m_freeIds, SlotState::FREE) && markListed(m_destroyQueue, SlotState::DYING);
+    for (SlotState& slot : m_slots) {
+        std::uint8_t value = static_cast<std::uint8_t>(slot);
+        if (value & LISTED) {
+            slot = static_cast<SlotState>(value & ~LISTED);
+        } else if (slot != SlotState::ALIVE) {
+            listed = false;
+        }
+    }
+    if (!listed) return false;
+    
+    if (!motions.restoreState(reader) || !bodies.restoreState(reader) || !bounds.restoreState(reader) ||
+        !gravities.restoreState(reader) || !lifetimes.restoreState(reader) || !sprites.restoreState(reader) ||
+        !projectiles.restoreState(reader) || !items.restoreState(reader)) {
+        return false;
+    }
+    
+    // Components are restored as raw bytes; flags, damage and the types that index tables must be in range
+    for (std::size_t i = 0; i < gravities.size(); ++i) {
+        std::uint8_t grounded = 0;
+        std::memcpy(&grounded, &gravities.at(i).grounded, 1);
+        if (grounded > 1) return false;
+    }
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        int type = static_cast<int>(items.at(i).type);
+        if (type < 0 || type >= ITEM_TYPE_COUNT) return false;
+    }
+    for (std::size_t i = 0; i < projectiles.size(); ++i) {
+        const ProjectileInfo& projectile = projectiles.at(i);
+        if (projectile.damage < 0) return false;
+        if (projectile.type != AmmoType::MELEE && projectile.type != AmmoType::BULLET &&
+            projectile.type != AmmoType::THROWN) {
+            return false;
+        }
+    }
+    for (std::size_t i = 0; i < sprites.size(); ++i) {
+        SpriteShape shape = sprites.at(i).shape;
+        if (shape != SpriteShape::RECT && shape != SpriteShape::ELLIPSE) return false;
+    }
+    return true;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file FramePacer.cpp
+ * @brief Frame pacer class implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "FramePacer.h"
+#include "GameConfig.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+FramePacer::FramePacer(QObject* parent)
+    : QObject(parent), m_isActive(false), m_targetHz(GameConfig::TARGET_FPS),
+      m_historyIndex(0), m_historyCount(0), m_lastError(0.0), m_frameCount(0), m_missedFrames(0) {
+    
+    m_period = std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1000000000LL / m_targetHz));
+    m_errorHistory.fill(0.0);
+    
+    m_timer = new QTimer(this);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    m_timer->setSingleShot(true);
+    connect(m_timer, &QTimer::timeout, this, &FramePacer::onTimerWake);
+}
+
+FramePacer::~FramePacer() {
+    stop();
+}
+
+void FramePacer::start() {
+    if (m_isActive) return;
+    
+    m_isActive = true;
+    m_lastFrameTime = Clock::now();
+    m_nextDeadline = m_lastFrameTime + m_period;
+    scheduleNextFrame();
+}
+
+void FramePacer::stop() {
+    m_isActive = false;
+    if (m_timer) {
+        m_timer->stop();
+    }
+}
+
+void FramePacer::setTargetHz(int hz) {
+    if (hz <= 0) return;
+    
+    m_targetHz = hz;
+    m_period = std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1000000000LL / hz));
+    resetStatistics();
+    
+    // Restart the schedule from now so the new period applies immediately
+    if (m_isActive) {
+        m_timer->stop();
+        m_nextDeadline = Clock::now() + m_period;
+        scheduleNextFrame();
+    }
+}
+
+int FramePacer::cycleTargetHz() {
+    int next = GameConfig::REFRESH_RATES[0];
+    for (int i = 0; i < GameConfig::REFRESH_RATE_COUNT; ++i) {
+        if (GameConfig::REFRESH_RATES[i] == m_targetHz) {
+            next = GameConfig::REFRESH_RATES[(i + 1) % GameConfig::REFRESH_RATE_COUNT];
+            break;
+        }
+    }
+    
+    setTargetHz(next);
+    return next;
+}
+
+void FramePacer::resetStatistics() {
+    m_errorHistory.fill(0.0);
+    m_historyIndex = 0;
+    m_historyCount = 0;
+    m_lastError = 0.0;
+    m_frameCount = 0;
+    m_missedFrames = 0;
+}
+
+double FramePacer::getAverageError() const {
+    if (m_historyCount == 0) return 0.0;
+    
+    double sum = 0.0;
+    for (int i = 0; i < m_historyCount; ++i) {
+        sum += std::abs(m_errorHistory[i]);
+    }
+    return sum / m_historyCount;
+}
+
+double FramePacer::getMaxError() const {
+    double maxError = 0.0;
+    for (int i = 0; i < m_historyCount; ++i) {
+        maxError = std::max(maxError, std::abs(m_errorHistory[i]));
+    }
+    return maxError;
+}
+
+void FramePacer::onTimerWake() {
+    if (!m_isActive) return;
+    
+    const auto spinThreshold = std::chrono::microseconds(GameConfig::FRAME_SPIN_THRESHOLD_US);
+    
+    // Woke up too early (timer resolution), go back to sleep
+    if (m_nextDeadline - Clock::now() > spinThreshold) {
+        scheduleNextFrame();
+        return;
+    }
+    
+    // Spin away the remainder for sub-millisecond accuracy
+    while (Clock::now() < m_nextDeadline) {
+        std::this_thread::yield();
+    }
+    
+    auto currentTime = Clock::now();
+    double errorMs = std::chrono::duration<double, std::milli>(currentTime - m_nextDeadline).count();
+    double deltaTime = std::chrono::duration<double>(currentTime - m_lastFrameTime).count();
+    m_lastFrameTime = currentTime;
+    recordError(errorMs);
+    
+    // Advance on the absolute schedule; resync if whole periods were overrun
+    m_nextDeadline += m_period;
+    if (currentTime >= m_nextDeadline) {
+        auto behind = (currentTime - m_nextDeadline) / m_period + 1;
+        m_missedFrames += behind;
+        m_nextDeadline += m_period * behind;
+    }
+    
+    m_frameCount++;
+    emit frameReady(deltaTime);
+    
+    scheduleNextFrame();
+}
+
+void FramePacer::scheduleNextFrame() {
+    if (!m_isActive) return;
+    
+    const auto spinThreshold = std::chrono::microseconds(GameConfig::FRAME_SPIN_THRESHOLD_US);
+    auto sleepTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+        m_nextDeadline - Clock::now() - spinThreshold);
+    
+    m_timer->start(static_cast<int>(std::max<long long>(0, sleepTime.count())));
+}
+
+void FramePacer::recordError(double errorMs) {
+    m_lastError = errorMs;
+    m_errorHistory[m_historyIndex] = errorMs;
+    m_historyIndex = (m_historyIndex + 1) % HISTORY_SIZE;
+    m_historyCount = std::min(m_historyCount + 1, HISTORY_SIZE);
+}
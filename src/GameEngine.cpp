@@ -7,59 +7,457 @@
 
 #include "GameEngine.h"
 #include "Item.h"
+#include "AllocationTracker.h"
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
+#include <random>
 #include <QDebug>
 
-GameEngine::GameEngine(QObject* parent) 
-    : QObject(parent), m_gameState(GameState::PLAYING), m_winner(0), m_randomGenerator(m_randomDevice()) {
+namespace {
+    /**
+     * @brief Convert an HSV color to RGB
+     * @param hue Hue (0-359)
+     * @param saturation Saturation (0-255)
+     * @param value Value (0-255)
+     * @return unsigned int Color (0xRRGGBB)
+     */
+    unsigned int hsvToRgb(int hue, int saturation, int value) {
+        int sector = hue / 60;
+        int fraction = (hue % 60) * 255 / 60;
+        int p = value * (255 - saturation) / 255;
+        int q = value * (255 - saturation * fraction / 255) / 255;
+        int t = value * (255 - saturation * (255 - fraction) / 255) / 255;
+        
+        int r, g, b;
+        switch (sector) {
+            case 0: r = value; g = t; b = p; break;
+            case 1: r = q; g = value; b = p; break;
+            case 2: r = p; g = value; b = t; break;
+            case 3: r = p; g = q; b = value; break;
+            case 4: r = t; g = p; b = value; break;
+            default: r = value; g = p; b = q; break;
+        }
+        return static_cast<unsigned int>(r) << 16 | static_cast<unsigned int>(g) << 8 | static_cast<unsigned int>(b);
+    }
+    
+    /**
+     * @brief Convert a level terrain code
+     * @param code LevelFormat::TerrainCode
+     * @return TerrainType Terrain type (GROUND for unknown codes)
+     */
+    TerrainType toTerrainType(std::uint32_t code) {
+        if (code == LevelFormat::TERRAIN_GRASS) return TerrainType::GRASS;
+        if (code == LevelFormat::TERRAIN_ICE) return TerrainType::ICE;
+        return TerrainType::GROUND;
+    }
+    
+    /**
+     * @brief Time until a point on a vertical parabola leaves a box it starts in
+     * @param origin Position at time 0
+     * @param velocity Velocity at time 0
+     * @param accelerationY Vertical acceleration
+     * @param boxMin Box minimum corner
+     * @param boxMax Box maximum corner
+     * @return double Seconds until the point crosses a side (0 when it starts outside, infinity when never)
+     */
+    double timeToLeaveBox(const Vector2D& origin, const Vector2D& velocity, double accelerationY,
+                          const Vector2D& boxMin, const Vector2D& boxMax) {
+        if (origin.x < boxMin.x || origin.x > boxMax.x || origin.y < boxMin.y || origin.y > boxMax.y) return 0.0;
+        
+        double time = std::numeric_limits<double>::infinity();
+        if (velocity.x > 0) {
+            time = (boxMax.x - origin.x) / velocity.x;
+        } else if (velocity.x < 0) {
+            time = (boxMin.x - origin.x) / velocity.x;
+        }
+        
+        // First positive crossing of the top or bottom edge
+        const double edges[2] = {boxMin.y, boxMax.y};
+        for (double edge : edges) {
+            double c = origin.y - edge;
+            if (accelerationY == 0.0) {
+                if (velocity.y != 0.0 && -c / velocity.y > 0.0) time = std::min(time, -c / velocity.y);
+                continue;
+            }
+            double a = 0.5 * accelerationY;
+            double discriminant = velocity.y * velocity.y - 4.0 * a * c;
+            if (discriminant < 0.0) continue;
+            double root = std::sqrt(discriminant);
+            for (double t : {(-velocity.y - root) / (2.0 * a), (-velocity.y + root) / (2.0 * a)}) {
+                if (t > 0.0) time = std::min(time, t);
+            }
+        }
+        return time;
+    }
+    
+    /**
+     * @brief Check if a box stands on the top of a platform (within 10 pixels below its top)
+     * @param position Box position
+     * @param size Box size
+     * @param platform The platform
+     * @return bool Whether the box is supported
+     */
+    bool isStandingOn(const Vector2D& position, const Vector2D& size, const LevelFormat::PlatformRecord& platform) {
+        double bottom = position.y + size.y;
+        return position.x + size.x > platform.x && position.x < platform.x + platform.width &&
+               bottom >= platform.y && bottom <= platform.y + 10;
+    }
+    
+    // Minimum loop indices per job chunk; shorter loops stay on the calling thread
+    constexpr std::size_t PLAYER_GRAIN = 16;
+    constexpr std::size_t ENTITY_GRAIN = 128;
+    
+    // Timers a player can have pending: weapon ready, attack ready, adrenaline heal and end
+    constexpr std::size_t TIMERS_PER_PLAYER = 4;
+    
+    /**
+     * @brief State touched by tick phases
+     */
+    enum TickState : std::uint32_t {
+        TICK_TIMERS = 1u << 0,        ///< Timer wheel
+        TICK_INPUT = 1u << 1,         ///< Input queue, held actions and bots
+        TICK_PLAYERS = 1u << 2,       ///< Player state and motion
+        TICK_PROJECTILES = 1u << 3,   ///< Projectile components
+        TICK_ITEMS = 1u << 4,         ///< Item components
+        TICK_POOL_LAYOUT = 1u << 5,   ///< Entity creation and pool order (adding, sleeping, waking, removing)
+        TICK_DESTROYED = 1u << 6,     ///< Entity slots and the destroy queue
+        TICK_STREAMER = 1u << 7,      ///< Resident chunks and their platforms
+        TICK_BOUNDS = 1u << 8,        ///< Bounds components
+        TICK_PLAYER_HOT = 1u << 9,    ///< Player hot state
+        TICK_GAME_STATE = 1u << 10    ///< Game state and winner
+    };
     
-    m_itemDropTimer = new QTimer(this);
-    connect(m_itemDropTimer, &QTimer::timeout, this, &GameEngine::spawnRandomItem);
+    /**
+     * @brief State a tick phase reads and writes
+     */
+    struct TickPhaseAccess {
+        TickPhase phase;        ///< The phase
+        std::uint32_t reads;    ///< TickState bits read
+        std::uint32_t writes;   ///< TickState bits written
+    };
+    
+    // Spawning (input, bots, timers) creates entities and schedules timers; streaming wakes
+    // items and reschedules projectile removal. Every phase that looks up components by entity
+    // reads TICK_POOL_LAYOUT, since sleeping, waking and removing move other entities' slots
+    constexpr std::uint32_t TICK_SPAWNING = TICK_TIMERS | TICK_PLAYERS | TICK_PROJECTILES | TICK_ITEMS |
+                                            TICK_POOL_LAYOUT | TICK_DESTROYED;
+    constexpr TickPhaseAccess TICK_PHASES[] = {
+        {TickPhase::TIMERS, TICK_STREAMER | TICK_GAME_STATE, TICK_SPAWNING},
+        {TickPhase::INPUT, TICK_STREAMER | TICK_BOUNDS | TICK_PLAYER_HOT, TICK_SPAWNING | TICK_INPUT | TICK_PLAYER_HOT},
+        {TickPhase::BOTS, TICK_STREAMER | TICK_BOUNDS | TICK_PLAYER_HOT | TICK_GAME_STATE,
+         TICK_SPAWNING | TICK_INPUT | TICK_PLAYER_HOT},
+        {TickPhase::STREAMING, TICK_PLAYERS, TICK_STREAMER | TICK_TIMERS | TICK_PROJECTILES | TICK_ITEMS | TICK_POOL_LAYOUT},
+        {TickPhase::PLAYER_MOVEMENT, TICK_POOL_LAYOUT, TICK_PLAYERS},
+        {TickPhase::INTEGRATION, TICK_POOL_LAYOUT, TICK_PLAYERS | TICK_PROJECTILES | TICK_ITEMS},
+        {TickPhase::PLAYER_CONTACTS, TICK_STREAMER | TICK_POOL_LAYOUT | TICK_BOUNDS, TICK_PLAYERS},
+        {TickPhase::PROJECTILES, TICK_PROJECTILES | TICK_STREAMER | TICK_POOL_LAYOUT, TICK_DESTROYED},
+        {TickPhase::ITEMS, TICK_STREAMER, TICK_ITEMS | TICK_POOL_LAYOUT | TICK_DESTROYED | TICK_BOUNDS},
+        {TickPhase::BOUNDS, TICK_PLAYERS | TICK_PROJECTILES | TICK_ITEMS | TICK_POOL_LAYOUT, TICK_BOUNDS},
+        {TickPhase::PLAYER_HOT_STATE, TICK_PLAYERS | TICK_POOL_LAYOUT, TICK_PLAYER_HOT},
+        {TickPhase::HITS, TICK_PROJECTILES | TICK_TIMERS | TICK_POOL_LAYOUT, TICK_PLAYERS | TICK_PLAYER_HOT | TICK_DESTROYED},
+        {TickPhase::FLUSH, 0, TICK_POOL_LAYOUT | TICK_DESTROYED | TICK_PLAYERS | TICK_PROJECTILES | TICK_ITEMS | TICK_BOUNDS},
+        {TickPhase::GAME_OVER, TICK_PLAYERS, TICK_GAME_STATE}
+    };
+    constexpr std::size_t TICK_PHASE_COUNT = sizeof(TICK_PHASES) / sizeof(TICK_PHASES[0]);
+    
+    /**
+     * @brief Check if two phases must not run concurrently
+     * @param a One phase
+     * @param b The other phase
+     * @return bool Whether one writes what the other reads or writes
+     */
+    constexpr bool conflicts(const TickPhaseAccess& a, const TickPhaseAccess& b) {
+        return (a.writes & (b.reads | b.writes)) || (a.reads & b.writes);
+    }
+    
+    /**
+     * @brief Assign the tick phases to waves
+     *
+     * A phase joins the wave after the latest earlier phase it conflicts with, so running a
+     * wave's phases concurrently gives the serial result as long as every phase declares all
+     * the state it touches.
+     * @return std::array<std::size_t, TICK_PHASE_COUNT> Wave of each phase
+     */
+    constexpr std::array<std::size_t, TICK_PHASE_COUNT> computeTickWaves() {
+        std::array<std::size_t, TICK_PHASE_COUNT> waveOf{};
+        for (std::size_t b = 0; b < TICK_PHASE_COUNT; ++b) {
+            for (std::size_t a = 0; a < b; ++a) {
+                if (conflicts(TICK_PHASES[a], TICK_PHASES[b]) && waveOf[a] + 1 > waveOf[b]) {
+                    waveOf[b] = waveOf[a] + 1;
+                }
+            }
+        }
+        return waveOf;
+    }
+    constexpr std::array<std::size_t, TICK_PHASE_COUNT> TICK_WAVE_OF = computeTickWaves();
+    
+    /**
+     * @brief Check that the table lists every phase once in TickPhase order
+     *
+     * The waves are derived from the declared reads and writes, so they are only as good as
+     * those declarations; this checks the table's order, not what the phases actually touch.
+     * @return bool Whether TICK_PHASES[i] is phase i for every phase
+     */
+    constexpr bool isTickTableOrdered() {
+        for (std::size_t i = 0; i < TICK_PHASE_COUNT; ++i) {
+            if (static_cast<std::size_t>(TICK_PHASES[i].phase) != i) return false;
+        }
+        return TICK_PHASE_COUNT == static_cast<std::size_t>(TickPhase::GAME_OVER) + 1;
+    }
+    static_assert(isTickTableOrdered(), "TICK_PHASES must list every tick phase in TickPhase order");
+    
+    /**
+     * @brief Group the tick phases into waves
+     * @return const std::vector<std::vector<TickPhase>>& Waves in run order
+     */
+    const std::vector<std::vector<TickPhase>>& getTickWaves() {
+        static const std::vector<std::vector<TickPhase>> waves = []() {
+            std::vector<std::vector<TickPhase>> result;
+            for (std::size_t i = 0; i < TICK_PHASE_COUNT; ++i) {
+                if (TICK_WAVE_OF[i] >= result.size()) result.resize(TICK_WAVE_OF[i] + 1);
+                result[TICK_WAVE_OF[i]].push_back(TICK_PHASES[i].phase);
+            }
+            return result;
+        }();
+        return waves;
+    }
+    
+    /**
+     * @brief Allocation phase of a tick phase
+     * @param phase The tick phase
+     * @return AllocationPhase Matching TICK_ entry
+     */
+    AllocationPhase toAllocationPhase(TickPhase phase) {
+        static_assert(static_cast<int>(AllocationPhase::TICK_GAME_OVER) - static_cast<int>(AllocationPhase::TICK_TIMERS) ==
+                      static_cast<int>(TickPhase::GAME_OVER), "AllocationPhase must list the tick phases in order");
+        return static_cast<AllocationPhase>(static_cast<int>(AllocationPhase::TICK_TIMERS) + static_cast<int>(phase));
+    }
+}
+
+GameEngine::GameEngine(QObject* parent) 
+    : QObject(parent), m_gameState(GameState::PLAYING), m_timerRemainder(0.0),
+      m_playerCount(GameConfig::DEFAULT_PLAYER_COUNT), m_teamCount(GameConfig::DEFAULT_PLAYER_COUNT), m_streamer(m_level), m_hasViewRegion(false), m_winner(0),
+      m_latencyTracker(nullptr), m_itemDropTimer(NO_TIMER), m_jobs(std::make_unique<JobSystem>(1)), m_entityCapacity(0) {
+    // Interactive games get fresh drops every run; simulations call setSeed()
+    setSeed(std::random_device()());
 }
 
 GameEngine::~GameEngine() {
-    if (m_itemDropTimer) {
-        m_itemDropTimer->stop();
-    }
 }
 
 void GameEngine::initialize() {
-    // Create players
-    Vector2D player1StartPos(200, GameConfig::GROUND_LEVEL - GameConfig::PLAYER_HEIGHT);
-    Vector2D player2StartPos(1000, GameConfig::GROUND_LEVEL - GameConfig::PLAYER_HEIGHT);
+    // Drop all entities and timers of the previous round
+    m_world.clear();
+    m_timers.clear();
+    m_timerRemainder = 0.0;
+    
+    // Room for a magazine in flight per player and every item the drops can leave lying around,
+    // so ticks do not allocate once a round has warmed up
+    std::size_t itemCapacity = m_balance.itemDropInterval > 0 ? GameConfig::ITEM_LIFETIME / m_balance.itemDropInterval + 1 : 0;
+    m_entityCapacity = static_cast<std::size_t>(m_playerCount) * (1 + GameConfig::PROJECTILES_RESERVED_PER_PLAYER) + itemCapacity;
+    m_world.reserve(m_entityCapacity);
+    m_timers.reserve(m_entityCapacity + static_cast<std::size_t>(m_playerCount) * TIMERS_PER_PLAYER + 1);
+    reserveChunkBuffers();
+    m_streamRegions.reserve(static_cast<std::size_t>(m_playerCount) + 1);
+    m_platforms.reserve(m_level.getPlatformCount());
     
-    m_player1 = std::make_shared<Player>(player1StartPos, QColor(0, 0, 255), true);  // Blue player 1
-    m_player2 = std::make_shared<Player>(player2StartPos, QColor(255, 0, 0), false); // Red player 2
+    // Respawn the existing players when the roster is unchanged, so a reset does not allocate
+    bool sameRoster = static_cast<int>(m_players.size()) == m_playerCount;
+    for (std::size_t i = 0; sameRoster && i < m_players.size(); ++i) {
+        sameRoster = m_players[i]->getTeam() == static_cast<int>(i) % m_teamCount;
+    }
+    if (sameRoster) {
+        for (int i = 0; i < m_playerCount; ++i) {
+            m_players[i]->respawn(getSpawnPosition(i));
+        }
+    } else {
+        // Create players at the level spawn points
+        m_players.clear();
+        for (int i = 0; i < m_playerCount; ++i) {
+            unsigned int color;
+            if (i == 0) {
+                color = 0x0000FF;  // Blue player 1
+            } else if (i == 1) {
+                color = 0xFF0000;  // Red player 2
+            } else {
+                color = hsvToRgb((i * 47) % 360, 200, 220);
+            }
+            m_players.push_back(std::make_shared<Player>(m_world, m_timers, getSpawnPosition(i), color, i,
+                                                               i % m_teamCount, m_balance));
+        }
+    }
+    m_playerHot.resize(m_players.size());
+    refreshPlayerHotState();
     
-    // Create map
-    createPlatforms();
+    // Page in the chunks around the spawn points
+    m_streamer.reset();
+    m_platforms.clear();
+    m_hasViewRegion = false;
+    streamChunks();
     
     // Reset game state
     m_gameState = GameState::PLAYING;
     m_winner = 0;
+    m_itemDropTimer = NO_TIMER;
+    scheduleItemDrop();
+    
+    // Drop pending input
+    m_inputQueue.clear();
+    m_heldActions.assign(m_players.size(), Action::NONE);
+}
+
+void GameEngine::setPlayerCount(int playerCount, int teamCount) {
+    m_playerCount = std::max(2, playerCount);
+    m_teamCount = teamCount > 0 ? teamCount : m_playerCount;
+    m_teamCount = std::clamp(m_teamCount, 2, std::min(m_playerCount, GameConfig::MAX_TEAMS));
+}
+
+void GameEngine::setThreadCount(int threads) {
+    m_jobs = std::make_unique<JobSystem>(threads);
+    reserveChunkBuffers();
+}
+
+void GameEngine::reserveChunkBuffers() {
+    // A chunk never holds more entries than the whole range
+    m_chunkRemovals.resize(m_jobs->getThreadCount());
+    m_chunkHits.resize(m_jobs->getThreadCount());
+    for (std::vector<Entity>& removals : m_chunkRemovals) {
+        removals.reserve(m_entityCapacity);
+    }
+    for (std::vector<std::pair<std::size_t, std::int32_t>>& hits : m_chunkHits) {
+        hits.reserve(m_entityCapacity);
+    }
+}
+
+void GameEngine::saveState(StateWriter& writer) const {
+    writer.write(STATE_MAGIC);
+    writer.write(static_cast<std::uint32_t>(m_players.size()));
+    writer.write(static_cast<std::uint32_t>(m_teamCount));
+    writer.write(static_cast<std::uint32_t>(m_level.getPlatformCount()));
+    
+    writer.write(m_gameState);
+    writer.write(m_winner);
+    writer.write(m_itemDropTimer);
+    writer.write(m_timerRemainder);
+    writer.write(m_balance);
+    writer.write(m_lootRandom);
+    writer.write(m_dropRandom);
+    writer.writeVector(m_heldActions);
+    
+    m_timers.saveState(writer);
+    m_world.saveState(writer);
+    for (const auto& player : m_players) {
+        player->saveState(writer);
+    }
+    m_streamer.saveState(writer);
+    
+    // Bots keep memory between ticks (held actions, random streams), so it is part of the state
+    for (std::size_t i = 0; i < m_players.size(); ++i) {
+        const BotController* bot = i < m_bots.size() ? m_bots[i].get() : nullptr;
+        writer.write(static_cast<std::uint8_t>(bot ? static_cast<int>(bot->getType()) + 1 : 0));
+        if (bot) bot->saveState(writer);
+    }
+}
+
+bool GameEngine::restoreState(StateReader& reader) {
+    std::uint32_t magic = 0, playerCount = 0, teamCount = 0, platformCount = 0;
+    reader.read(magic);
+    reader.read(playerCount);
+    reader.read(teamCount);
+    reader.read(platformCount);
+    if (!reader.isValid() || magic != STATE_MAGIC || playerCount != m_players.size() ||
+        static_cast<int>(teamCount) != m_teamCount || platformCount != m_level.getPlatformCount()) {
+        return false;
+    }
+    
+    reader.read(m_gameState);
+    reader.read(m_winner);
+    reader.read(m_itemDropTimer);
+    reader.read(m_timerRemainder);
+    reader.read(m_balance);
+    reader.read(m_lootRandom);
+    reader.read(m_dropRandom);
+    reader.readVector(m_heldActions);
+    if (!reader.isValid() || m_heldActions.size() != m_players.size()) return false;
+    
+    // advanceTimers() converts the remainder to whole milliseconds, so it must be a fraction
+    int state = static_cast<int>(m_gameState);
+    if (state < static_cast<int>(GameState::PLAYING) || state > static_cast<int>(GameState::GAME_OVER) ||
+        m_winner < 0 || m_winner > m_teamCount ||
+        !std::isfinite(m_timerRemainder) || m_timerRemainder < 0.0 || m_timerRemainder >= 1.0) {
+        return false;
+    }
+    
+    if (!m_timers.restoreState(reader) || !m_world.restoreState(reader)) return false;
+    for (const auto& player : m_players) {
+        // The support platform indexes the level's platforms
+        if (!player->restoreState(reader) ||
+            player->getSupportPlatform() >= static_cast<std::int32_t>(m_level.getPlatformCount())) {
+            return false;
+        }
+    }
+    
+    // Resident chunks are restored as they were, so items wake at the same ticks as in the original
+    if (!m_streamer.restoreState(reader)) return false;
+    rebuildPlatforms();
+    
+    // The snapshot only fits a match with the same bots attached
+    for (std::size_t i = 0; i < m_players.size(); ++i) {
+        BotController* bot = i < m_bots.size() ? m_bots[i].get() : nullptr;
+        std::uint8_t type = 0;
+        if (!reader.read(type) || type != (bot ? static_cast<int>(bot->getType()) + 1 : 0)) return false;
+        if (bot && !bot->restoreState(reader)) return false;
+    }
+    
+    // Derived state follows from the restored players
+    m_inputQueue.clear();
+    refreshPlayerHotState();
+    return true;
+}
+
+std::shared_ptr<Player> GameEngine::getPlayer(int index) const {
+    if (index < 0 || index >= static_cast<int>(m_players.size())) return nullptr;
+    return m_players[index];
+}
+
+Vector2D GameEngine::getSpawnPosition(int index) const {
+    // Players beyond the spawn points line up next to them
+    std::uint32_t spawnCount = m_level.getSpawnCount();
+    const LevelFormat::SpawnRecord& spawn = m_level.getSpawn(static_cast<std::uint32_t>(index) % spawnCount);
+    double offset = (index / static_cast<int>(spawnCount)) * GameConfig::PLAYER_WIDTH * 1.5;
+    double maxX = m_level.getWorldWidth() - GameConfig::PLAYER_WIDTH;
+    
+    return Vector2D(std::fmod(spawn.x + offset, maxX), spawn.y);
+}
+
+bool GameEngine::loadLevel(const QString& path, QString* error) {
+    bool loaded = m_level.load(path, error);
     
-    // Clear lists
-    m_projectiles.clear();
-    m_items.clear();
+    // Chunk state refers to the previous level's platforms
+    m_streamer.reset();
+    m_platforms.clear();
+    return loaded;
+}
+
+void GameEngine::setViewRegion(const Vector2D& min, const Vector2D& max) {
+    m_viewRegion = StreamRegion{min, max};
+    m_hasViewRegion = true;
 }
 
 void GameEngine::startGame() {
     if (m_gameState != GameState::PLAYING) {
         m_gameState = GameState::PLAYING;
     }
-    
-    // Start item drop timer
-    m_itemDropTimer->start(GameConfig::ITEM_DROP_INTERVAL);
 }
 
 void GameEngine::togglePause() {
+    // The item drop timer runs on simulated time, so it stops with the game
     if (m_gameState == GameState::PLAYING) {
         m_gameState = GameState::PAUSED;
-        m_itemDropTimer->stop();
     } else if (m_gameState == GameState::PAUSED) {
         m_gameState = GameState::PLAYING;
-        m_itemDropTimer->start(GameConfig::ITEM_DROP_INTERVAL);
     }
 }
 
@@ -71,122 +469,286 @@ void GameEngine::resetGame() {
 void GameEngine::update(double deltaTime) {
     if (m_gameState != GameState::PLAYING) return;
     
-    // Update players
-    if (m_player1 && m_player1->isAlive()) {
-        m_player1->update(deltaTime);
+    for (const std::vector<TickPhase>& wave : getTickWaves()) {
+        if (wave.size() == 1) {
+            runPhase(wave.front(), deltaTime);
+            continue;
+        }
+        m_jobs->parallelFor(wave.size(), 1, [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                runPhase(wave[i], deltaTime);
+            }
+        });
     }
+}
+
+void GameEngine::runPhase(TickPhase phase, double deltaTime) {
+    AllocationTracker::Scope scope(toAllocationPhase(phase));
     
-    if (m_player2 && m_player2->isAlive()) {
-        m_player2->update(deltaTime);
+    switch (phase) {
+        case TickPhase::TIMERS:
+            // Fire the timers due by now; expired entities are gone before anything sees them
+            advanceTimers(deltaTime);
+            break;
+        case TickPhase::INPUT:
+            // Apply input captured since the previous tick
+            processInput();
+            break;
+        case TickPhase::BOTS:
+            updateBots();
+            break;
+        case TickPhase::STREAMING:
+            // Keep the chunks around the players resident; when platforms change, resting items re-check
+            // their support and projectile impacts are predicted again
+            if (streamChunks()) {
+                wakeItems();
+                for (std::size_t i = 0; i < m_world.projectiles.size(); ++i) {
+                    scheduleProjectileRemoval(m_world.projectiles.entityAt(i));
+                }
+            }
+            break;
+        case TickPhase::PLAYER_MOVEMENT:
+            m_jobs->parallelFor(m_players.size(), PLAYER_GRAIN, [&](std::size_t, std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    if (m_players[i]->isAlive()) {
+                        m_players[i]->update(deltaTime);
+                    }
+                }
+            });
+            break;
+        case TickPhase::INTEGRATION:
+            // Integrate gravity and motion of all entities; velocities are final before anything moves
+            m_jobs->parallelFor(m_world.gravities.awakeSize(), ENTITY_GRAIN, [&](std::size_t, std::size_t begin, std::size_t end) {
+                m_world.applyGravity(deltaTime, begin, end);
+            });
+            m_jobs->parallelFor(m_world.motions.awakeSize(), ENTITY_GRAIN, [&](std::size_t, std::size_t begin, std::size_t end) {
+                m_world.advanceMotions(deltaTime, begin, end);
+            });
+            break;
+        case TickPhase::PLAYER_CONTACTS:
+            updatePhysics(deltaTime);
+            break;
+        case TickPhase::PROJECTILES:
+            updateProjectiles(deltaTime);
+            break;
+        case TickPhase::ITEMS:
+            updateItems(deltaTime);
+            break;
+        case TickPhase::BOUNDS:
+            // Refresh bounding boxes for collision queries
+            m_jobs->parallelFor(m_world.bounds.awakeSize(), ENTITY_GRAIN, [&](std::size_t, std::size_t begin, std::size_t end) {
+                m_world.updateBounds(begin, end);
+            });
+            break;
+        case TickPhase::PLAYER_HOT_STATE:
+            refreshPlayerHotState();
+            break;
+        case TickPhase::HITS:
+            checkCollisions(deltaTime);
+            break;
+        case TickPhase::FLUSH:
+            // Remove everything destroyed this tick
+            m_world.flushDestroyed();
+            break;
+        case TickPhase::GAME_OVER:
+            checkGameOver();
+            break;
     }
+}
+
+void GameEngine::checkGameOver() {
+    std::uint32_t aliveTeams = 0;
+    for (const auto& player : m_players) {
+        if (player->isAlive()) {
+            aliveTeams |= player->getTeamMask();
+        }
+    }
+    
+    // Continue while two or more teams have living players
+    if (aliveTeams & (aliveTeams - 1)) return;
     
-    // Update physics system
-    updatePhysics(deltaTime);
+    m_winner = 0;
+    for (int team = 0; team < m_teamCount; ++team) {
+        if (aliveTeams == (1u << team)) {
+            m_winner = team + 1;
+        }
+    }
+    m_gameState = GameState::GAME_OVER;
+}
+
+void GameEngine::handleKeyPress(Qt::Key key, long long timestamp) {
+    if (m_gameState != GameState::PLAYING) return;
     
-    // Update projectiles
-    updateProjectiles(deltaTime);
+    m_inputQueue.push(InputEvent{timestamp != 0 ? timestamp : LatencyTracker::now(), key, true});
+}
+
+void GameEngine::handleKeyRelease(Qt::Key key, long long timestamp) {
+    if (m_gameState != GameState::PLAYING) return;
     
-    // Update items
-    updateItems(deltaTime);
+    m_inputQueue.push(InputEvent{timestamp != 0 ? timestamp : LatencyTracker::now(), key, false});
+}
+
+void GameEngine::processInput() {
+    if (m_inputQueue.isEmpty()) return;
     
-    // Check collisions
-    checkCollisions();
+    long long tickTimestamp = m_latencyTracker ? LatencyTracker::now() : 0;
     
-    // Check game over conditions
-    if (!m_player1->isAlive()) {
-        m_winner = 2;
-        m_gameState = GameState::GAME_OVER;
-        m_itemDropTimer->stop();
-    } else if (!m_player2->isAlive()) {
-        m_winner = 1;
-        m_gameState = GameState::GAME_OVER;
-        m_itemDropTimer->stop();
+    InputEvent event;
+    while (m_inputQueue.pop(event)) {
+        const KeyBindings::Binding* binding = m_keyBindings.lookup(event.key);
+        if (!binding) continue;
+        
+        if (m_latencyTracker) {
+            m_latencyTracker->recordConsumed(event.timestamp, tickTimestamp);
+        }
+        applyPlayerAction(binding->playerIndex, binding->action, event.pressed);
     }
 }
 
-void GameEngine::handleKeyPress(Qt::Key key) {
+void GameEngine::setPlayerActions(int playerIndex, ActionMask actions) {
     if (m_gameState != GameState::PLAYING) return;
+    if (playerIndex < 0 || playerIndex >= static_cast<int>(m_players.size())) return;
     
-    // Player 1 controls
-    if (key == GameConfig::PLAYER1_LEFT) {
-        m_player1->moveLeft();
-    } else if (key == GameConfig::PLAYER1_RIGHT) {
-        m_player1->moveRight();
-    } else if (key == GameConfig::PLAYER1_JUMP) {
-        m_player1->jump();
-    } else if (key == GameConfig::PLAYER1_CROUCH) {
-        m_player1->crouch();
-        // Try to pick up items
-        for (auto& item : m_items) {
-            if (item->isValid()) {
-                Vector2D playerPos = m_player1->getPosition();
-                Vector2D playerSize(m_player1->getWidth(), m_player1->getHeight());
-                Vector2D itemPos = item->getPosition();
-                Vector2D itemSize(item->getWidth(), item->getHeight());
-                
-                // Expand pickup range
-                Vector2D expandedPlayerPos(playerPos.x - 30, playerPos.y - 30);
-                Vector2D expandedPlayerSize(playerSize.x + 60, playerSize.y + 60);
-                
-                if (checkRectCollision(expandedPlayerPos, expandedPlayerSize, itemPos, itemSize)) {
-                    if (m_player1->pickupItem(item)) {
-                        break;
-                    }
-                }
-            }
+    // Apply every changed action bit as a press or release edge
+    ActionMask changed = m_heldActions[playerIndex] ^ actions;
+    for (ActionMask bit = 1; changed != 0; bit <<= 1) {
+        if (changed & bit) {
+            applyPlayerAction(playerIndex, bit, (actions & bit) != 0);
+            changed &= ~bit;
         }
-    } else if (key == GameConfig::PLAYER1_FIRE) {
-        handlePlayerAttack(m_player1);
-    }
-    
-    // Player 2 controls
-    if (key == GameConfig::PLAYER2_LEFT) {
-        m_player2->moveLeft();
-    } else if (key == GameConfig::PLAYER2_RIGHT) {
-        m_player2->moveRight();
-    } else if (key == GameConfig::PLAYER2_JUMP) {
-        m_player2->jump();
-    } else if (key == GameConfig::PLAYER2_CROUCH) {
-        m_player2->crouch();
-        // Try to pick up items
-        for (auto& item : m_items) {
-            if (item->isValid()) {
-                Vector2D playerPos = m_player2->getPosition();
-                Vector2D playerSize(m_player2->getWidth(), m_player2->getHeight());
-                Vector2D itemPos = item->getPosition();
-                Vector2D itemSize(item->getWidth(), item->getHeight());
-                
-                // Expand pickup range
-                Vector2D expandedPlayerPos(playerPos.x - 30, playerPos.y - 30);
-                Vector2D expandedPlayerSize(playerSize.x + 60, playerSize.y + 60);
-                
-                if (checkRectCollision(expandedPlayerPos, expandedPlayerSize, itemPos, itemSize)) {
-                    if (m_player2->pickupItem(item)) {
-                        break;
-                    }
-                }
-            }
+    }
+}
+
+void GameEngine::setBot(int playerIndex, std::unique_ptr<BotController> bot) {
+    if (playerIndex < 0) return;
+    
+    if (playerIndex >= static_cast<int>(m_bots.size())) {
+        m_bots.resize(playerIndex + 1);
+    }
+    m_bots[playerIndex] = std::move(bot);
+}
+
+void GameEngine::updateBots() {
+    std::size_t count = std::min(m_bots.size(), m_players.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!m_bots[i] || !m_players[i]->isAlive()) continue;
+        
+        setPlayerActions(static_cast<int>(i), m_bots[i]->decide(observe(static_cast<int>(i))));
+    }
+}
+
+BotObservation GameEngine::observe(int playerIndex) const {
+    BotObservation observation{};
+    std::shared_ptr<Player> player = getPlayer(playerIndex);
+    if (!player) return observation;
+    
+    const WeaponState& weapon = player->getWeapon();
+    observation.position = player->getPosition();
+    observation.velocity = player->getVelocity();
+    observation.grounded = player->isGrounded();
+    observation.facingRight = player->isFacingRight();
+    observation.hp = player->getHP();
+    observation.melee = weapon.isMelee();
+    observation.attackRange = weapon.getAttackRange();
+    observation.canAttack = weapon.canAttack();
+    
+    // Nearest opponent that can be seen and hit
+    std::uint32_t teamMask = player->getTeamMask();
+    for (std::size_t p = 0; p < m_players.size(); ++p) {
+        if (!m_playerHot.targetable[p] || (m_playerHot.teamMask[p] & teamMask)) continue;
+        
+        double distance = observation.position.distanceTo(m_playerHot.min[p]);
+        if (!observation.hasOpponent || distance < observation.opponentDistance) {
+            observation.hasOpponent = true;
+            observation.opponentPosition = m_playerHot.min[p];
+            observation.opponentDistance = distance;
+        }
+    }
+    
+    // Nearest item
+    for (std::size_t i = 0; i < m_world.items.size(); ++i) {
+        Entity entity = m_world.items.entityAt(i);
+        if (!m_world.isAlive(entity)) continue;
+        
+        Vector2D itemPos = m_world.motions.get(entity).position;
+        double distance = observation.position.distanceTo(itemPos);
+        if (!observation.hasItem || distance < observation.itemDistance) {
+            observation.hasItem = true;
+            observation.itemPosition = itemPos;
+            observation.itemDistance = distance;
         }
-    } else if (key == GameConfig::PLAYER2_FIRE) {
-        handlePlayerAttack(m_player2);
     }
+    
+    return observation;
 }
 
-void GameEngine::handleKeyRelease(Qt::Key key) {
-    if (m_gameState != GameState::PLAYING) return;
+void GameEngine::applyPlayerAction(int playerIndex, ActionMask action, bool pressed) {
+    std::shared_ptr<Player> player = getPlayer(playerIndex);
+    if (!player) return;
+    
+    ActionMask& held = m_heldActions[playerIndex];
     
-    // Player 1 controls
-    if (key == GameConfig::PLAYER1_LEFT || key == GameConfig::PLAYER1_RIGHT) {
-        m_player1->stopMoving();
-    } else if (key == GameConfig::PLAYER1_CROUCH) {
-        m_player1->stopCrouching();
+    if (pressed) {
+        held |= action;
+        
+        switch (action) {
+            case Action::LEFT:
+                player->moveLeft();
+                break;
+            case Action::RIGHT:
+                player->moveRight();
+                break;
+            case Action::JUMP:
+                player->jump();
+                break;
+            case Action::CROUCH:
+                player->crouch();
+                tryPickupItem(player);
+                break;
+            case Action::FIRE:
+                handlePlayerAttack(player);
+                break;
+        }
+    } else {
+        held &= ~action;
+        
+        switch (action) {
+            case Action::LEFT:
+            case Action::RIGHT:
+                player->stopMoving();
+                // Resume the opposite direction if it is still held
+                if (held & Action::LEFT) {
+                    player->moveLeft();
+                } else if (held & Action::RIGHT) {
+                    player->moveRight();
+                }
+                break;
+            case Action::CROUCH:
+                player->stopCrouching();
+                break;
+        }
     }
+}
+
+void GameEngine::tryPickupItem(std::shared_ptr<Player> player) {
+    Vector2D playerPos = player->getPosition();
+    Vector2D playerSize(player->getWidth(), player->getHeight());
+    
+    // Expand pickup range
+    Vector2D expandedPlayerPos(playerPos.x - 30, playerPos.y - 30);
+    Vector2D expandedPlayerSize(playerSize.x + 60, playerSize.y + 60);
     
-    // Player 2 controls
-    if (key == GameConfig::PLAYER2_LEFT || key == GameConfig::PLAYER2_RIGHT) {
-        m_player2->stopMoving();
-    } else if (key == GameConfig::PLAYER2_CROUCH) {
-        m_player2->stopCrouching();
+    for (std::size_t i = 0; i < m_world.items.size(); ++i) {
+        Entity entity = m_world.items.entityAt(i);
+        if (!m_world.isAlive(entity)) continue;
+        
+        const Bounds& itemBounds = m_world.bounds.get(entity);
+        if (checkRectCollision(expandedPlayerPos, expandedPlayerSize, itemBounds.min, itemBounds.max - itemBounds.min)) {
+            if (player->pickupItem(m_world.items.at(i).type)) {
+                m_world.destroy(entity);
+                break;
+            }
+        }
     }
 }
 
@@ -196,126 +758,299 @@ void GameEngine::spawnRandomItem() {
     ItemType itemType = generateRandomItemType();
     Vector2D dropPos = generateRandomDropPosition();
     
-    std::shared_ptr<Item> item;
+    spawnItem(itemType, dropPos);
+}
+
+void GameEngine::setSeed(std::uint64_t seed, std::uint64_t match) {
+    m_lootRandom = RandomStream(seed, match, RandomPurpose::LOOT);
+    m_dropRandom = RandomStream(seed, match, RandomPurpose::DROP_POSITION);
+}
+
+void GameEngine::setBalance(const BalanceConfig& balance) {
+    // Time since the pending drop was scheduled carries over to the new interval
+    std::int64_t deadline = m_timers.getDeadline(m_itemDropTimer);
+    std::int64_t waited = deadline >= 0 ? m_timers.getTime() - (deadline - m_balance.itemDropInterval) : 0;
+    
+    m_balance = balance;
+    scheduleItemDrop(waited);
+}
+
+void GameEngine::scheduleItemDrop(std::int64_t waited) {
+    m_timers.cancel(m_itemDropTimer);
+    m_itemDropTimer = NO_TIMER;
+    if (m_balance.itemDropInterval <= 0) return; // Drops disabled
     
-    switch (itemType) {
-        case ItemType::WEAPON_KNIFE:
-        case ItemType::WEAPON_BALL:
-        case ItemType::WEAPON_RIFLE:
-        case ItemType::WEAPON_SNIPER:
-            item = std::make_shared<WeaponItem>(itemType, dropPos);
-            break;
-        case ItemType::BANDAGE:
-            item = std::make_shared<BandageItem>(dropPos);
+    m_itemDropTimer = m_timers.schedule(m_balance.itemDropInterval - waited, TimerKind::ITEM_DROP, 0);
+}
+
+void GameEngine::advanceTimers(double deltaTime) {
+    // Whole simulated milliseconds; the fraction carries over to the next tick
+    double elapsed = deltaTime * 1000.0 + m_timerRemainder;
+    double whole = std::floor(elapsed);
+    m_timerRemainder = elapsed - whole;
+    
+    m_timers.advance(static_cast<std::int64_t>(whole), [this](const TimerEvent& event) { onTimer(event); });
+    m_world.flushDestroyed();
+}
+
+void GameEngine::onTimer(const TimerEvent& event) {
+    switch (event.kind) {
+        case TimerKind::ITEM_DROP:
+            if (event.handle == m_itemDropTimer) {
+                spawnRandomItem();
+                scheduleItemDrop();
+            }
             break;
-        case ItemType::MEDKIT:
-            item = std::make_shared<MedkitItem>(dropPos);
+        case TimerKind::ENTITY_EXPIRY: {
+            // Entities destroyed early leave their timer behind; a recycled id holds a different handle
+            const Lifetime* lifetime = m_world.lifetimes.find(event.target);
+            if (lifetime && lifetime->timer == event.handle) {
+                m_world.destroy(event.target);
+            }
             break;
-        case ItemType::ADRENALINE:
-            item = std::make_shared<AdrenalineItem>(dropPos);
+        }
+        default:
+            if (event.target < m_players.size()) {
+                m_players[event.target]->onTimer(event);
+            }
             break;
     }
+}
+
+void GameEngine::spawnItem(ItemType type, const Vector2D& position) {
+    const ItemSpec& spec = getItemSpec(type);
+    Vector2D size(spec.width, spec.height);
+    
+    Entity entity = m_world.create();
+    m_world.motions.add(entity, Motion{position, Vector2D(0, GameConfig::ITEM_FALL_SPEED)});
+    m_world.bodies.add(entity, Body{Vector2D(0, 0), size, 0.0});
+    m_world.bounds.add(entity, Bounds{position, position + size});
+    m_world.gravities.add(entity, Gravity{1.0, false});
+    m_world.lifetimes.add(entity,
+                          Lifetime{m_timers.schedule(GameConfig::ITEM_LIFETIME, TimerKind::ENTITY_EXPIRY, entity)});
+    m_world.sprites.add(entity, Sprite{spec.color, SpriteShape::RECT, spec.label});
+    m_world.items.add(entity, ItemInfo{type});
+}
+
+void GameEngine::spawnProjectile(const ProjectileLaunch& launch) {
+    double radius = getProjectileRadius(launch.type);
+    Vector2D offset(-radius, -radius);
+    Vector2D size(radius * 2, radius * 2);
     
-    if (item) {
-        m_items.push_back(item);
+    Entity entity = m_world.create();
+    m_world.motions.add(entity, Motion{launch.position, launch.velocity});
+    m_world.bodies.add(entity, Body{offset, size, radius});
+    m_world.bounds.add(entity, Bounds{launch.position + offset, launch.position + offset + size});
+    m_world.lifetimes.add(entity, Lifetime{NO_TIMER});
+    m_world.projectiles.add(entity, ProjectileInfo{launch.damage, launch.type, launch.ownerId, launch.teamMask,
+                                                   m_timers.getTime() + GameConfig::PROJECTILE_LIFETIME});
+    
+    // Thrown projectiles follow a parabola, bullets fly straight
+    if (launch.type == AmmoType::THROWN) {
+        m_world.gravities.add(entity, Gravity{1.0, false});
+        m_world.sprites.add(entity, Sprite{0xFFA500, SpriteShape::ELLIPSE, 0}); // Orange projectile
+    } else {
+        m_world.sprites.add(entity, Sprite{0xFFFF00, SpriteShape::ELLIPSE, 0}); // Yellow bullet
     }
+    
+    scheduleProjectileRemoval(entity);
 }
 
-void GameEngine::createPlatforms() {
-    m_platforms.clear();
+void GameEngine::scheduleProjectileRemoval(Entity entity) {
+    const Motion& motion = m_world.motions.get(entity);
+    const Gravity* gravity = m_world.gravities.find(entity);
+    double accelerationY = gravity ? GameConfig::GRAVITY * gravity->scale : 0.0;
+    double radius = m_world.bodies.get(entity).radius;
     
-    // Ground
-    m_platforms.emplace_back(Vector2D(0, GameConfig::GROUND_LEVEL), 
-                           GameConfig::WINDOW_WIDTH, 50, 
-                           TerrainType::GROUND, QColor(139, 69, 19));
+    // Whatever comes first: the end of the lifetime, leaving the world or a platform. Delays
+    // are rounded down to whole milliseconds, so the timer never fires a tick late
+    std::int64_t delay = m_world.projectiles.get(entity).expiry - m_timers.getTime();
+    Vector2D worldMin(-100, -100);
+    Vector2D worldMax(m_level.getWorldWidth() + 100, m_level.getWorldHeight() + 100);
+    double horizon = std::min(delay / 1000.0, timeToLeaveBox(motion.position, motion.velocity, accelerationY,
+                                                             worldMin, worldMax));
+    delay = std::min(delay, static_cast<std::int64_t>(horizon * 1000.0));
     
-    // Central platform (grass)
-    m_platforms.emplace_back(Vector2D(450, 600), 
-                           300, 20, 
-                           TerrainType::GRASS, QColor(34, 139, 34));
+    double impact = 0.0;
+    std::int32_t platform = -1;
+    if (m_streamer.predictImpact(motion.position, motion.velocity, accelerationY, radius, horizon, impact, platform)) {
+        delay = std::min(delay, static_cast<std::int64_t>(impact * 1000.0));
+    }
     
-    // Left platform (ice)
-    m_platforms.emplace_back(Vector2D(100, 500), 
-                           200, 20, 
-                           TerrainType::ICE, QColor(173, 216, 230));
+    Lifetime& lifetime = m_world.lifetimes.get(entity);
+    m_timers.cancel(lifetime.timer);
+    lifetime.timer = m_timers.schedule(delay, TimerKind::ENTITY_EXPIRY, entity);
+}
+
+void GameEngine::fireHitscan(const ProjectileLaunch& launch, double range) {
+    RayHit hit;
+    if (!raycast(launch.position, launch.velocity, range, getProjectileRadius(launch.type), launch.teamMask, hit) ||
+        hit.player < 0) {
+        return;
+    }
     
-    // Right platform (normal)
-    m_platforms.emplace_back(Vector2D(900, 500), 
-                           200, 20, 
-                           TerrainType::GROUND, QColor(139, 69, 19));
+    Player& target = *m_players[hit.player];
+    target.takeDamage(launch.damage);
+    m_playerHot.targetable[hit.player] = target.isAlive();
+}
+
+bool GameEngine::raycast(const Vector2D& origin, const Vector2D& direction, double maxDistance, double radius,
+                         std::uint32_t ignoreTeams, RayHit& hit) const {
+    Vector2D unit = direction.normalized();
+    bool found = m_streamer.raycastPlatforms(origin, unit, maxDistance, radius, hit);
     
-    // High-level platform (ice)
-    m_platforms.emplace_back(Vector2D(350, 400), 
-                           400, 20, 
-                           TerrainType::ICE, QColor(173, 216, 230));
+    // Players count only in front of the platform hit
+    for (std::size_t p = 0; p < m_players.size(); ++p) {
+        if (!m_playerHot.targetable[p] || (m_playerHot.teamMask[p] & ignoreTeams)) continue;
+        
+        double distance = 0.0;
+        Vector2D normal;
+        if (intersectCircleCastBox(origin, unit, radius, m_playerHot.min[p], m_playerHot.max[p],
+                                   found ? hit.distance : maxDistance, distance, normal) &&
+            (!found || distance < hit.distance || (distance == hit.distance && hit.player < 0))) {
+            hit.distance = distance;
+            hit.normal = normal;
+            hit.platform = -1;
+            hit.player = static_cast<std::int32_t>(p);
+            found = true;
+        }
+    }
     
-    // Top-left small platform (grass)
-    m_platforms.emplace_back(Vector2D(50, 300), 
-                           150, 20, 
-                           TerrainType::GRASS, QColor(34, 139, 34));
+    if (found) {
+        hit.point = origin + unit * hit.distance;
+    }
+    return found;
+}
+
+bool GameEngine::streamChunks() {
+    m_streamRegions.clear();
+    
+    Vector2D margin(GameConfig::CHUNK_STREAM_MARGIN, GameConfig::CHUNK_STREAM_MARGIN);
+    for (const auto& player : m_players) {
+        if (!player->isAlive()) continue;
+        Vector2D position = player->getPosition();
+        Vector2D size(player->getWidth(), player->getHeight());
+        m_streamRegions.push_back(StreamRegion{position - margin, position + size + margin});
+    }
+    if (m_hasViewRegion) {
+        m_streamRegions.push_back(m_viewRegion);
+    }
+    
+    if (!m_streamer.update(m_streamRegions)) return false;
     
-    // Top-right small platform (grass)
-    m_platforms.emplace_back(Vector2D(1000, 300), 
-                           150, 20, 
-                           TerrainType::GRASS, QColor(34, 139, 34));
+    rebuildPlatforms();
+    return true;
+}
+
+void GameEngine::rebuildPlatforms() {
+    m_platforms.clear();
+    for (std::uint32_t index : m_streamer.getActivePlatforms()) {
+        const LevelFormat::PlatformRecord& record = m_level.getPlatform(index);
+        
+        m_platforms.emplace_back(Vector2D(record.x, record.y), 
+                               record.width, record.height, 
+                               toTerrainType(record.terrain), record.color);
+    }
 }
 
 void GameEngine::updatePhysics(double deltaTime) {
-    // Check player-platform collision
-    checkPlayerPlatformCollision(m_player1);
-    checkPlayerPlatformCollision(m_player2);
+    // Players do not collide with each other, so their contacts resolve independently
+    m_jobs->parallelFor(m_players.size(), PLAYER_GRAIN, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::shared_ptr<Player>& player = m_players[i];
+            if (!player->isAlive()) continue;
+            
+            // Keep players inside the world
+            player->applyWorldBounds(m_level.getWorldWidth());
+            
+            // Check player-platform collision
+            checkPlayerPlatformCollision(player);
+        }
+    });
 }
 
 void GameEngine::updateProjectiles(double deltaTime) {
-    // Update projectiles
-    for (auto& projectile : m_projectiles) {
-        projectile->update(deltaTime);
-    }
+    // Leaving the world and hitting platforms are scheduled at spawn; which chunks are resident
+    // depends on where the players go, so that is checked every tick
+    const std::size_t count = m_world.projectiles.size();
+    const std::size_t chunks = m_jobs->getChunkCount(count, ENTITY_GRAIN);
+    if (m_chunkRemovals.size() < chunks) m_chunkRemovals.resize(chunks);
     
-    // Remove invalid projectiles
-    m_projectiles.erase(
-        std::remove_if(m_projectiles.begin(), m_projectiles.end(),
-                      [](const std::shared_ptr<Projectile>& p) {
-                          return !p->isValid();
-                      }),
-        m_projectiles.end()
-    );
+    m_jobs->parallelFor(count, ENTITY_GRAIN, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        std::vector<Entity>& removals = m_chunkRemovals[chunk];
+        removals.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            Entity entity = m_world.projectiles.entityAt(i);
+            if (!m_streamer.isResident(m_world.motions.get(entity).position)) {
+                removals.push_back(entity);
+            }
+        }
+    });
+    
+    // Destruction queues entities, so it is applied in pool order
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        for (Entity entity : m_chunkRemovals[chunk]) {
+            m_world.destroy(entity);
+        }
+    }
 }
 
 void GameEngine::updateItems(double deltaTime) {
-    // Update items
-    for (auto& item : m_items) {
-        item->update(deltaTime);
-        
-        // Check item-platform collision
-        Vector2D itemPos = item->getPosition();
-        Vector2D itemSize(item->getWidth(), item->getHeight());
-        
-        for (const auto& platform : m_platforms) {
-            if (checkRectCollision(itemPos, itemSize, 
-                                 platform.position, Vector2D(platform.width, platform.height))) {
-                // Item landed on platform
-                item->setPosition(Vector2D(itemPos.x, platform.position.y - item->getHeight()));
-                item->setVelocity(Vector2D(0, 0));
-                item->setGrounded(true);
-                break;
+    // Falling items land in parallel: each reads the level and writes only its own components
+    m_jobs->parallelFor(m_world.items.awakeSize(), ENTITY_GRAIN, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            Entity entity = m_world.items.entityAt(i);
+            Motion& motion = m_world.motions.get(entity);
+            Gravity& gravity = m_world.gravities.get(entity);
+            
+            // Items left behind in paged-out chunks are dropped below instead
+            if (gravity.grounded || !m_streamer.isResident(motion.position)) continue;
+            
+            // Land on the highest platform top edge the item's bottom passed this tick, or that
+            // lies inside the item
+            Vector2D itemSize = m_world.bodies.get(entity).size;
+            double bottom = motion.position.y + itemSize.y;
+            double fallen = std::max<double>(motion.velocity.y * deltaTime, static_cast<double>(itemSize.y));
+            std::int32_t platform = m_streamer.findSurface(motion.position.x, motion.position.x + itemSize.x,
+                                                           bottom - fallen, bottom);
+            if (platform >= 0) {
+                motion.position.y = m_level.getPlatform(platform).y - itemSize.y;
+                motion.velocity = Vector2D(0, 0);
+                gravity.grounded = true;
             }
         }
-    }
+    });
     
-    // Remove invalid items
-    m_items.erase(
-        std::remove_if(m_items.begin(), m_items.end(),
-                      [](const std::shared_ptr<Item>& item) {
-                          return !item->isValid();
-                      }),
-        m_items.end()
-    );
+    // Sleeping and dropping change the pools and run serially; awake items are never grounded
+    // before landing, so only items that landed above go to sleep. A sleeping item swaps the
+    // next awake item into slot i
+    for (std::size_t i = 0; i < m_world.items.awakeSize();) {
+        Entity entity = m_world.items.entityAt(i);
+        
+        // Landed items rest until the platforms around them change
+        if (m_world.gravities.get(entity).grounded) {
+            m_world.sleep(entity);
+            continue;
+        }
+        if (!m_streamer.isResident(m_world.motions.get(entity).position)) {
+            m_world.destroy(entity);
+        }
+        ++i;
+    }
 }
 
-void GameEngine::checkCollisions() {
-    checkProjectilePlayerCollision();
-    checkProjectilePlatformCollision();
+void GameEngine::wakeItems() {
+    // Sleeping items sit behind the awake ones; each wake moves one across
+    while (m_world.items.awakeSize() < m_world.items.size()) {
+        Entity entity = m_world.items.entityAt(m_world.items.awakeSize());
+        m_world.wake(entity);
+        m_world.gravities.get(entity).grounded = false;
+    }
+}
+
+void GameEngine::checkCollisions(double deltaTime) {
+    checkProjectilePlayerCollision(deltaTime);
+    // Projectile-platform impacts are scheduled, see scheduleProjectileRemoval()
     // Player-item collision is checked in key handling
 }
 
@@ -326,61 +1061,113 @@ void GameEngine::checkPlayerPlatformCollision(std::shared_ptr<Player> player) {
     Vector2D playerSize(player->getWidth(), player->getHeight());
     Vector2D playerVel = player->getVelocity();
     
-    bool nowGrounded = false;
+    // The platform stood on last tick usually still carries the player
+    std::int32_t support = player->getSupportPlatform();
+    if (support >= 0 && !(m_streamer.isPlatformActive(static_cast<std::uint32_t>(support)) &&
+                          isStandingOn(playerPos, playerSize, m_level.getPlatform(support)))) {
+        support = -1;
+    }
+    
+    // One pass over the platforms around the player resolves penetrations; every test uses the
+    // position before resolution, the last penetrated platform decides
+    bool collided = false;
+    std::int32_t landing = -1;
+    Vector2D resolvedPos = playerPos;
+    Vector2D resolvedVel = playerVel;
     
-    for (const auto& platform : m_platforms) {
-        Vector2D platformPos = platform.position;
+    m_streamer.queryPlatforms(playerPos, playerPos + playerSize, [&](std::uint32_t index) {
+        const LevelFormat::PlatformRecord& platform = m_level.getPlatform(index);
+        Vector2D platformPos(platform.x, platform.y);
         Vector2D platformSize(platform.width, platform.height);
         
         if (checkRectCollision(playerPos, playerSize, platformPos, platformSize)) {
+            collided = true;
             // Landing on platform from above
             if (playerVel.y > 0 && playerPos.y < platformPos.y) {
-                player->setPosition(Vector2D(playerPos.x, platformPos.y - playerSize.y));
-                player->setVelocity(Vector2D(playerVel.x, 0));
-                nowGrounded = true;
+                resolvedPos = Vector2D(playerPos.x, platformPos.y - playerSize.y);
+                resolvedVel = Vector2D(playerVel.x, 0);
+                landing = static_cast<std::int32_t>(index);
             }
             // Hitting platform from below
             else if (playerVel.y < 0 && playerPos.y > platformPos.y) {
-                player->setPosition(Vector2D(playerPos.x, platformPos.y + platformSize.y));
-                player->setVelocity(Vector2D(playerVel.x, 0));
+                resolvedPos = Vector2D(playerPos.x, platformPos.y + platformSize.y);
+                resolvedVel = Vector2D(playerVel.x, 0);
             }
             // Hitting platform from side
             else {
                 if (playerVel.x > 0) {
-                    player->setPosition(Vector2D(platformPos.x - playerSize.x, playerPos.y));
+                    resolvedPos = Vector2D(platformPos.x - playerSize.x, playerPos.y);
                 } else if (playerVel.x < 0) {
-                    player->setPosition(Vector2D(platformPos.x + platformSize.x, playerPos.y));
+                    resolvedPos = Vector2D(platformPos.x + platformSize.x, playerPos.y);
                 }
-                player->setVelocity(Vector2D(0, playerVel.y));
+                resolvedVel = Vector2D(0, playerVel.y);
             }
         }
-    }
+        return false;
+    });
     
-    // Check if player is standing on any platform (including ground)
-    if (!nowGrounded) {
-        // Check if on ground
-        if (playerPos.y + playerSize.y >= GameConfig::GROUND_LEVEL - 5) {
-            nowGrounded = true;
-        } else {
-            // Check if standing on platform
-            for (const auto& platform : m_platforms) {
-                Vector2D platformPos = platform.position;
-                Vector2D platformSize(platform.width, platform.height);
-                
-                // Check horizontal overlap
-                if (playerPos.x + playerSize.x > platformPos.x && 
-                    playerPos.x < platformPos.x + platformSize.x) {
-                    // Check if standing on platform top
-                    if (playerPos.y + playerSize.y >= platformPos.y && 
-                        playerPos.y + playerSize.y <= platformPos.y + 10) {
-                        nowGrounded = true;
-                        break;
-                    }
-                }
+    // Without a penetration at the end of the tick the player may still have passed through a
+    // thin platform on a long step: sweep the box from where the previous tick left it
+    Vector2D previousPos = m_world.bounds.get(player->getEntity()).min;
+    Vector2D displacement = playerPos - previousPos;
+    if (!collided && (displacement.x != 0 || displacement.y != 0)) {
+        std::int32_t first = -1;
+        double firstTime = 0.0;
+        Vector2D firstNormal;
+        Vector2D sweptMin(std::min(previousPos.x, playerPos.x), std::min(previousPos.y, playerPos.y));
+        Vector2D sweptMax(std::max(previousPos.x, playerPos.x), std::max(previousPos.y, playerPos.y));
+        m_streamer.queryPlatforms(sweptMin, sweptMax + playerSize, [&](std::uint32_t index) {
+            const LevelFormat::PlatformRecord& platform = m_level.getPlatform(index);
+            Vector2D platformMin(platform.x, platform.y);
+            Vector2D platformMax(platform.x + platform.width, platform.y + platform.height);
+            double time = 0.0;
+            Vector2D normal;
+            std::int32_t platformIndex = static_cast<std::int32_t>(index);
+            if (sweepBoxBox(previousPos, previousPos + playerSize, displacement, platformMin, platformMax, time, normal) &&
+                (first < 0 || time < firstTime || (time == firstTime && platformIndex < first))) {
+                first = platformIndex;
+                firstTime = time;
+                firstNormal = normal;
+            }
+            return false;
+        });
+        
+        // The first face reached stops the motion along its normal, as a penetration would
+        if (first >= 0 && (firstNormal.x != 0 || firstNormal.y != 0)) {
+            const LevelFormat::PlatformRecord& platform = m_level.getPlatform(first);
+            collided = true;
+            if (firstNormal.y < 0) {
+                resolvedPos = Vector2D(playerPos.x, platform.y - playerSize.y);
+                resolvedVel = Vector2D(playerVel.x, 0);
+                landing = first;
+            } else if (firstNormal.y > 0) {
+                resolvedPos = Vector2D(playerPos.x, platform.y + platform.height);
+                resolvedVel = Vector2D(playerVel.x, 0);
+            } else {
+                resolvedPos = Vector2D(firstNormal.x < 0 ? platform.x - playerSize.x : platform.x + platform.width,
+                                       playerPos.y);
+                resolvedVel = Vector2D(0, playerVel.y);
             }
         }
     }
     
+    // Otherwise the highest top edge within 10 pixels above the feet carries the player
+    double bottom = playerPos.y + playerSize.y;
+    if (support < 0) {
+        support = m_streamer.findSurface(playerPos.x, playerPos.x + playerSize.x, bottom - 10, bottom);
+    }
+    
+    if (collided) {
+        player->setPosition(resolvedPos);
+        player->setVelocity(resolvedVel);
+    }
+    
+    // A landing decides the support; otherwise the player stands on a platform or the ground
+    if (landing >= 0) {
+        support = landing;
+    }
+    bool nowGrounded = support >= 0 || bottom >= GameConfig::GROUND_LEVEL - 5;
+    
     // Update player's ground state
     if (nowGrounded) {
         if (!player->isGrounded()) {
@@ -392,109 +1179,143 @@ void GameEngine::checkPlayerPlatformCollision(std::shared_ptr<Player> player) {
         // Force set ground state
         player->setGrounded(true);
         
-        // Update terrain type (after setting ground state)
-        TerrainType currentTerrain = getPlayerTerrainType(player);
-        player->setTerrainType(currentTerrain);
+        // Terrain of the supporting platform
+        const LevelFormat::PlatformRecord* platform = support >= 0 ? &m_level.getPlatform(support) : nullptr;
+        player->setTerrainType(platform ? toTerrainType(platform->terrain) : TerrainType::GROUND);
+        player->setSupportPlatform(support);
     } else {
         player->setGrounded(false);
         // Set to normal terrain when airborne
         player->setTerrainType(TerrainType::GROUND);
+        player->setSupportPlatform(-1);
     }
 }
 
-void GameEngine::checkProjectilePlayerCollision() {
-    for (auto it = m_projectiles.begin(); it != m_projectiles.end();) {
-        auto& projectile = *it;
-        bool hit = false;
-        
-        // Check collision with player 1
-        if (projectile->getOwnerId() != 0) { // Not fired by player 1
-            Vector2D p1Pos = m_player1->getPosition();
-            Vector2D p1Size(m_player1->getWidth(), m_player1->getHeight());
+void GameEngine::refreshPlayerHotState() {
+    m_jobs->parallelFor(m_players.size(), PLAYER_GRAIN, [&](std::size_t, std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const Player& player = *m_players[i];
+            Vector2D position = player.getPosition();
             
-            if (!m_player1->isInvisible() && 
-                checkCircleRectCollision(projectile->getPosition(), projectile->getRadius(), p1Pos, p1Size)) {
-                m_player1->takeDamage(projectile->getDamage());
-                hit = true;
-            }
+            m_playerHot.min[i] = position;
+            m_playerHot.max[i] = position + Vector2D(player.getWidth(), player.getHeight());
+            m_playerHot.teamMask[i] = player.getTeamMask();
+            m_playerHot.targetable[i] = player.isAlive() && !player.isInvisible();
         }
-        
-        // Check collision with player 2
-        if (!hit && projectile->getOwnerId() != 1) { // Not fired by player 2
-            Vector2D p2Pos = m_player2->getPosition();
-            Vector2D p2Size(m_player2->getWidth(), m_player2->getHeight());
-            
-            if (!m_player2->isInvisible() && 
-                checkCircleRectCollision(projectile->getPosition(), projectile->getRadius(), p2Pos, p2Size)) {
-                m_player2->takeDamage(projectile->getDamage());
-                hit = true;
-            }
+    });
+}
+
+void GameEngine::checkProjectilePlayerCollision(double deltaTime) {
+    const std::size_t count = m_world.projectiles.size();
+    const std::size_t chunks = m_jobs->getChunkCount(count, ENTITY_GRAIN);
+    if (m_chunkHits.size() < chunks) m_chunkHits.resize(chunks);
+    
+    m_jobs->parallelFor(count, ENTITY_GRAIN, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        std::vector<std::pair<std::size_t, std::int32_t>>& hits = m_chunkHits[chunk];
+        hits.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            std::int32_t target = findProjectileTarget(i, deltaTime);
+            if (target >= 0) hits.emplace_back(i, target);
         }
-        
-        if (hit) {
-            it = m_projectiles.erase(it);
-        } else {
-            ++it;
+    });
+    
+    // Apply hits in projectile order. Players only stop being targetable here, so a target that is
+    // still targetable is still the nearest one; otherwise the projectile looks again
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        for (const std::pair<std::size_t, std::int32_t>& hit : m_chunkHits[chunk]) {
+            std::int32_t target = hit.second;
+            if (!m_playerHot.targetable[target]) {
+                target = findProjectileTarget(hit.first, deltaTime);
+                if (target < 0) continue;
+            }
+            
+            Player& player = *m_players[target];
+            player.takeDamage(m_world.projectiles.at(hit.first).damage);
+            m_playerHot.targetable[target] = player.isAlive();
+            m_world.destroy(m_world.projectiles.entityAt(hit.first));
         }
     }
 }
 
-void GameEngine::checkProjectilePlatformCollision() {
-    for (auto it = m_projectiles.begin(); it != m_projectiles.end();) {
-        auto& projectile = *it;
-        bool hit = false;
-        
-        for (const auto& platform : m_platforms) {
-            Vector2D platformPos = platform.position;
-            Vector2D platformSize(platform.width, platform.height);
-            
-            if (checkCircleRectCollision(projectile->getPosition(), projectile->getRadius(), 
-                                       platformPos, platformSize)) {
-                hit = true;
-                break;
-            }
-        }
+std::int32_t GameEngine::findProjectileTarget(std::size_t index, double deltaTime) const {
+    Entity entity = m_world.projectiles.entityAt(index);
+    if (!m_world.isAlive(entity)) return -1; // Already left the world
+    
+    const ProjectileInfo& projectile = m_world.projectiles.at(index);
+    const Motion& motion = m_world.motions.get(entity);
+    double radius = m_world.bodies.get(entity).radius;
+    
+    // Integration moved the projectile by velocity * deltaTime this tick; the path is cut
+    // where its scheduled removal (a platform impact) ends the flight
+    const double tickLength = deltaTime * 1000.0;
+    Vector2D path = motion.velocity * deltaTime;
+    double length = path.length();
+    Vector2D start = motion.position - path;
+    Vector2D direction = length > 0.0 ? path / length : Vector2D();
+    std::int64_t remaining = m_timers.getDeadline(m_world.lifetimes.get(entity).timer) - m_timers.getTime();
+    if (remaining >= 0 && remaining < tickLength) {
+        length *= remaining / tickLength;
+    }
+    
+    // The first targetable player of another team the circle touches along the path takes the hit
+    std::int32_t target = -1;
+    double targetDistance = 0.0;
+    for (std::size_t p = 0; p < m_players.size(); ++p) {
+        if (!m_playerHot.targetable[p] || (m_playerHot.teamMask[p] & projectile.teamMask)) continue;
         
-        if (hit) {
-            it = m_projectiles.erase(it);
-        } else {
-            ++it;
+        double distance = 0.0;
+        Vector2D normal;
+        if (intersectCircleCastBox(start, direction, radius, m_playerHot.min[p], m_playerHot.max[p],
+                                   target >= 0 ? targetDistance : length, distance, normal) &&
+            (target < 0 || distance < targetDistance)) {
+            target = static_cast<std::int32_t>(p);
+            targetDistance = distance;
         }
     }
+    return target;
 }
 
 void GameEngine::handlePlayerAttack(std::shared_ptr<Player> player) {
-    if (!player || !player->getWeapon()) return;
+    if (!player) return;
     
     player->attack();
     
-    auto weapon = player->getWeapon();
-    Vector2D targetPos = player->getPosition();
+    WeaponState& weapon = player->getWeapon();
+    if (!weapon.trigger(m_timers, player->getIndex())) return;
     
-    // Melee weapon direct damage detection
-    if (weapon->getType() == WeaponType::FIST || weapon->getType() == WeaponType::KNIFE) {
-        if (!weapon->canAttack()) return;
-        
-        std::shared_ptr<Player> target = (player == m_player1) ? m_player2 : m_player1;
+    // Melee weapon damages every targetable opponent in range and in front
+    if (weapon.isMelee()) {
         Vector2D playerPos = player->getPosition();
-        Vector2D targetPlayerPos = target->getPosition();
+        double attackRange = weapon.getAttackRange();
+        std::uint32_t teamMask = player->getTeamMask();
         
-        double distance = playerPos.distanceTo(targetPlayerPos);
-        double attackRange = weapon->getAttackRange();
-        
-        // Check attack direction
-        bool facingTarget = (player->isFacingRight() && targetPlayerPos.x > playerPos.x) ||
-                          (!player->isFacingRight() && targetPlayerPos.x < playerPos.x);
-        
-        if (distance <= attackRange && facingTarget && !target->isInvisible()) {
-            target->takeDamage(weapon->getDamage());
+        for (std::size_t p = 0; p < m_players.size(); ++p) {
+            if (!m_playerHot.targetable[p] || (m_playerHot.teamMask[p] & teamMask)) continue;
+            
+            Vector2D targetPlayerPos = m_playerHot.min[p];
+            double distance = playerPos.distanceTo(targetPlayerPos);
+            
+            // Check attack direction
+            bool facingTarget = (player->isFacingRight() && targetPlayerPos.x > playerPos.x) ||
+                              (!player->isFacingRight() && targetPlayerPos.x < playerPos.x);
+            
+            if (distance <= attackRange && facingTarget) {
+                Player& target = *m_players[p];
+                target.takeDamage(weapon.getDamage());
+                m_playerHot.targetable[p] = target.isAlive();
+            }
         }
     }
     // Ranged weapon generate projectiles
     else {
-        auto projectile = weapon->attack(player.get(), targetPos);
-        if (projectile) {
-            m_projectiles.push_back(projectile);
+        ProjectileLaunch launch;
+        if (!computeProjectileLaunch(weapon, *player, launch)) return;
+        
+        // Hitscan bullets never become entities
+        if (launch.type == AmmoType::BULLET && weapon.getSpec().hitscan) {
+            fireHitscan(launch, weapon.getAttackRange());
+        } else {
+            spawnProjectile(launch);
         }
     }
 }
@@ -519,39 +1340,8 @@ bool GameEngine::checkCircleRectCollision(const Vector2D& circlePos, double radi
     return distance <= radius;
 }
 
-TerrainType GameEngine::getPlayerTerrainType(std::shared_ptr<Player> player) {
-    Vector2D playerPos = player->getPosition();
-    Vector2D playerSize(player->getWidth(), player->getHeight());
-    
-    // Only detect terrain type for grounded players
-    if (!player->isGrounded()) {
-        return TerrainType::GROUND;
-    }
-    
-    for (const auto& platform : m_platforms) {
-        Vector2D platformPos = platform.position;
-        Vector2D platformSize(platform.width, platform.height);
-        
-        // Check if player is within platform's horizontal range
-        if (playerPos.x + playerSize.x > platformPos.x &&
-            playerPos.x < platformPos.x + platformSize.x) {
-            // Check if player is standing on platform top (with tolerance)
-            double playerBottom = playerPos.y + playerSize.y;
-            if (playerBottom >= platformPos.y - 5 && 
-                playerBottom <= platformPos.y + platformSize.y + 15) {
-                return platform.type;
-            }
-        }
-    }
-    
-    return TerrainType::GROUND;
-}
-
 ItemType GameEngine::generateRandomItemType() {
-    std::uniform_int_distribution<int> dist(0, 6);
-    int type = dist(m_randomGenerator);
-    
-    switch (type) {
+    switch (m_lootRandom.nextBelow(7)) {
         case 0: return ItemType::WEAPON_KNIFE;
         case 1: return ItemType::WEAPON_BALL;
         case 2: return ItemType::WEAPON_RIFLE;
@@ -564,8 +1354,13 @@ ItemType GameEngine::generateRandomItemType() {
 }
 
 Vector2D GameEngine::generateRandomDropPosition() {
-    std::uniform_real_distribution<double> xDist(100, GameConfig::WINDOW_WIDTH - 100);
-    double x = xDist(m_randomGenerator);
+    // Drop within a screen width around a random player so the item lands in resident chunks
+    std::shared_ptr<Player> player = m_players[m_dropRandom.nextBelow(static_cast<std::uint32_t>(m_players.size()))];
+    double halfRange = GameConfig::WINDOW_WIDTH / 2.0 - 100;
+    double minX = std::max(100.0, player->getPosition().x - halfRange);
+    double maxX = std::min(m_level.getWorldWidth() - 100, player->getPosition().x + halfRange);
+    
+    double x = m_dropRandom.nextRange(minX, std::max(minX, maxX));
     double y = GameConfig::ITEM_DROP_HEIGHT;
     
     return Vector2D(x, y);
@@ -10,43 +10,69 @@
 #include <QKeyEvent>
 #include <QApplication>
 #include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <random>
 
-GameWindow::GameWindow(QWidget* parent) : QMainWindow(parent), m_frameCount(0), m_currentFPS(0.0) {
+GameWindow::GameWindow(QWidget* parent)
+    : QMainWindow(parent), m_renderStats{0, 0}, m_frameCount(0), m_currentFPS(0.0), m_showLatencyOverlay(false),
+      m_showAllocationOverlay(false) {
     
     // Initialize game engine
     m_gameEngine = std::make_unique<GameEngine>();
     m_gameEngine->initialize();
+    m_gameEngine->setLatencyTracker(&m_latencyTracker);
     
     // Initialize UI
     initializeUI();
+    updateCamera(0.0, true);
     
     // Set window properties
     setWindowTitle("QtGame - 2D Battle Game");
     setFixedSize(GameConfig::WINDOW_WIDTH, GameConfig::WINDOW_HEIGHT);
     setFocusPolicy(Qt::StrongFocus);
     
-    // Initialize timer
-    m_gameTimer = new QTimer(this);
-    connect(m_gameTimer, &QTimer::timeout, this, &GameWindow::gameLoop);
+    // Initialize frame pacer
+    m_framePacer = new FramePacer(this);
+    connect(m_framePacer, &FramePacer::frameReady, this, &GameWindow::gameLoop);
     
     // Initialize time-related variables
-    m_lastFrameTime = std::chrono::high_resolution_clock::now();
     m_fpsUpdateTime = std::chrono::high_resolution_clock::now();
     
-    // Start game loop, targeting 60FPS
-    int timerInterval = 1000 / GameConfig::TARGET_FPS;
-    m_gameTimer->start(timerInterval);
+    // Start game loop at the configured target refresh rate
+    m_framePacer->setTargetHz(GameConfig::TARGET_FPS);
+    m_framePacer->start();
     
     // Start game
     m_gameEngine->startGame();
 }
 
 GameWindow::~GameWindow() {
-    if (m_gameTimer) {
-        m_gameTimer->stop();
+    if (m_framePacer) {
+        m_framePacer->stop();
     }
 }
 
+bool GameWindow::exportLatencyStatistics(const QString& path) const {
+    return m_latencyTracker.exportStatistics(path);
+}
+
+bool GameWindow::exportAllocationTrace(const QString& path) const {
+    return m_allocationTrace.exportTrace(path);
+}
+
+bool GameWindow::loadLevel(const QString& path, QString* error) {
+    if (!m_gameEngine->loadLevel(path, error)) return false;
+    
+    m_gameEngine->resetGame();
+    updateCamera(0.0, true);
+    return true;
+}
+
+void GameWindow::setBot(int playerIndex, BotType type) {
+    m_gameEngine->setBot(playerIndex, createBot(type, std::random_device()()));
+}
+
 void GameWindow::initializeUI() {
     // Don't set central widget, draw directly on QMainWindow
     // This way paintEvent can work properly
@@ -59,9 +85,17 @@ void GameWindow::paintEvent(QPaintEvent* event) {
     // Now call complete game drawing
     drawGame(&painter);
     updateFPS();
+    
+    // Input consumed before this frame is now reflected on screen
+    m_latencyTracker.recordPresented(LatencyTracker::now());
+    
+    // A frame's allocations are those of the ticks since the previous paint and of this paint
+    m_allocationTrace.recordFrame();
 }
 
 void GameWindow::keyPressEvent(QKeyEvent* event) {
+    long long timestamp = LatencyTracker::now();
+    
     if (event->isAutoRepeat()) {
         return; // Ignore auto repeat
     }
@@ -72,6 +106,7 @@ void GameWindow::keyPressEvent(QKeyEvent* event) {
     // Special key handling
     if (key == Qt::Key_R && m_gameEngine->getGameState() == GameState::GAME_OVER) {
         m_gameEngine->resetGame();
+        updateCamera(0.0, true);
         return;
     }
     
@@ -80,16 +115,43 @@ void GameWindow::keyPressEvent(QKeyEvent* event) {
         return;
     }
     
+    if (key == Qt::Key_F2) {
+        m_framePacer->cycleTargetHz();
+        return;
+    }
+    
+    if (key == Qt::Key_F3) {
+        m_showLatencyOverlay = !m_showLatencyOverlay;
+        return;
+    }
+    
+    if (key == Qt::Key_F4) {
+        exportLatencyStatistics("latency_stats.csv");
+        return;
+    }
+    
+    if (key == Qt::Key_F5) {
+        m_showAllocationOverlay = !m_showAllocationOverlay;
+        return;
+    }
+    
+    if (key == Qt::Key_F6) {
+        exportAllocationTrace("allocation_trace.csv");
+        return;
+    }
+    
     if (key == Qt::Key_Escape) {
         QApplication::quit();
         return;
     }
     
-    m_gameEngine->handleKeyPress(key);
+    m_gameEngine->handleKeyPress(key, timestamp);
     QMainWindow::keyPressEvent(event);
 }
 
 void GameWindow::keyReleaseEvent(QKeyEvent* event) {
+    long long timestamp = LatencyTracker::now();
+    
     if (event->isAutoRepeat()) {
         return; // Ignore auto repeat
     }
@@ -97,45 +159,87 @@ void GameWindow::keyReleaseEvent(QKeyEvent* event) {
     Qt::Key key = static_cast<Qt::Key>(event->key());
     m_pressedKeys.erase(key);
     
-    m_gameEngine->handleKeyRelease(key);
+    m_gameEngine->handleKeyRelease(key, timestamp);
     QMainWindow::keyReleaseEvent(event);
 }
 
 void GameWindow::closeEvent(QCloseEvent* event) {
-    if (m_gameTimer) {
-        m_gameTimer->stop();
+    if (m_framePacer) {
+        m_framePacer->stop();
     }
     QMainWindow::closeEvent(event);
 }
 
-void GameWindow::gameLoop() {
-    auto currentTime = std::chrono::high_resolution_clock::now();
-    auto deltaTimeMs = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - m_lastFrameTime).count();
-    double deltaTime = deltaTimeMs / 1000000.0; // Convert to seconds
-    m_lastFrameTime = currentTime;
-    
+void GameWindow::gameLoop(double deltaTime) {
     // Update game state
     m_gameEngine->update(deltaTime);
+    updateCamera(deltaTime);
     
     // Repaint window
     update();
 }
 
-void GameWindow::drawGame(QPainter* painter) {
-    // Draw background
-    drawBackground(painter);
-    
-    // Draw platforms
-    drawPlatforms(painter);
+void GameWindow::updateCamera(double deltaTime, bool snap) {
+    // Center on the midpoint of the living players
+    Vector2D focus;
+    int count = 0;
+    for (const auto& player : m_gameEngine->getPlayers()) {
+        if (!player->isAlive()) continue;
+        focus += player->getPosition() + Vector2D(player->getWidth(), player->getHeight()) * 0.5;
+        count++;
+    }
+    if (count == 0) return;
+    focus = focus / count;
+    
+    // Keep the view inside the world
+    const Level& level = m_gameEngine->getLevel();
+    Vector2D viewSize(width(), height());
+    Vector2D target = focus - viewSize * 0.5;
+    target.x = std::clamp<double>(target.x, 0.0, std::max(0.0, level.getWorldWidth() - viewSize.x));
+    target.y = std::clamp<double>(target.y, 0.0, std::max(0.0, level.getWorldHeight() - viewSize.y));
+    
+    if (snap) {
+        m_camera = target;
+    } else {
+        m_camera += (target - m_camera) * std::min(1.0, deltaTime * GameConfig::CAMERA_FOLLOW_RATE);
+    }
     
-    // Draw players
-    drawPlayers(painter);
+    // What is on screen must stay resident
+    m_gameEngine->setViewRegion(m_camera, m_camera + viewSize);
+}
+
+bool GameWindow::isOnScreen(const Vector2D& min, const Vector2D& max) const {
+    // One pixel slack for outlines
+    return max.x >= m_camera.x - 1 && min.x <= m_camera.x + width() + 1 &&
+           max.y >= m_camera.y - 1 && min.y <= m_camera.y + height() + 1;
+}
+
+void GameWindow::drawGame(QPainter* painter) {
+    m_renderStats = RenderStats{0, 0};
     
-    // Draw projectiles
-    drawProjectiles(painter);
+    {
+        AllocationTracker::Scope scope(AllocationPhase::RENDER_WORLD);
+        
+        // Draw background
+        drawBackground(painter);
+        
+        // World layers are drawn in world coordinates relative to the camera
+        painter->save();
+        painter->translate(-std::round(m_camera.x), -std::round(m_camera.y));
+        
+        // Draw platforms
+        drawPlatforms(painter);
+        
+        // Draw players
+        drawPlayers(painter);
+        
+        // Draw projectiles and items
+        drawEntities(painter);
+        
+        painter->restore();
+    }
     
-    // Draw items
-    drawItems(painter);
+    AllocationTracker::Scope scope(AllocationPhase::RENDER_HUD);
     
     // Draw UI
     drawUI(painter);
@@ -156,13 +260,35 @@ void GameWindow::drawBackground(QPainter* painter) {
 }
 
 void GameWindow::drawPlatforms(QPainter* painter) {
-    for (const auto& platform : m_gameEngine->getPlatforms()) {
+    // Collect platforms in grid cells overlapping the view; spanning platforms appear more than once
+    Vector2D viewMax = m_camera + Vector2D(width(), height());
+    m_visiblePlatforms.clear();
+    m_gameEngine->getStreamer().queryPlatforms(m_camera, viewMax, [this](std::uint32_t index) {
+        m_visiblePlatforms.push_back(index);
+        return false;
+    });
+    std::sort(m_visiblePlatforms.begin(), m_visiblePlatforms.end());
+    m_visiblePlatforms.erase(std::unique(m_visiblePlatforms.begin(), m_visiblePlatforms.end()), m_visiblePlatforms.end());
+    
+    const Level& level = m_gameEngine->getLevel();
+    int submitted = 0;
+    
+    for (std::uint32_t index : m_visiblePlatforms) {
+        const LevelFormat::PlatformRecord& platform = level.getPlatform(index);
+        
+        // Grid cells are coarser than the view
+        if (!isOnScreen(Vector2D(platform.x, platform.y),
+                        Vector2D(platform.x + platform.width, platform.y + platform.height))) {
+            continue;
+        }
+        submitted++;
+        
         painter->setPen(Qt::black);
-        painter->setBrush(platform.color);
+        painter->setBrush(QColor::fromRgb(platform.color));
         
         QRect platformRect(
-            static_cast<int>(platform.position.x),
-            static_cast<int>(platform.position.y),
+            static_cast<int>(platform.x),
+            static_cast<int>(platform.y),
             static_cast<int>(platform.width),
             static_cast<int>(platform.height)
         );
@@ -174,11 +300,11 @@ void GameWindow::drawPlatforms(QPainter* painter) {
         painter->setFont(QFont("Arial", 8));
         
         QString terrainText;
-        switch (platform.type) {
-            case TerrainType::GRASS:
+        switch (platform.terrain) {
+            case LevelFormat::TERRAIN_GRASS:
                 terrainText = "Grass(Stealth)";
                 break;
-            case TerrainType::ICE:
+            case LevelFormat::TERRAIN_ICE:
                 terrainText = "Ice(Speed)";
                 break;
             default:
@@ -190,21 +316,32 @@ void GameWindow::drawPlatforms(QPainter* painter) {
             painter->drawText(platformRect, Qt::AlignCenter, terrainText);
         }
     }
+    
+    m_renderStats.drawn += submitted;
+    m_renderStats.culled += static_cast<int>(m_gameEngine->getPlatforms().size()) - submitted;
 }
 
 void GameWindow::drawPlayers(QPainter* painter) {
-    if (m_gameEngine->getPlayer1() && m_gameEngine->getPlayer1()->isAlive()) {
-        drawPlayer(painter, m_gameEngine->getPlayer1());
-    }
+    // Held weapons reach up to 40 px beyond the body
+    const Vector2D weaponReach(40, 0);
     
-    if (m_gameEngine->getPlayer2() && m_gameEngine->getPlayer2()->isAlive()) {
-        drawPlayer(painter, m_gameEngine->getPlayer2());
+    for (const auto& player : m_gameEngine->getPlayers()) {
+        if (!player->isAlive()) continue;
+        
+        Vector2D pos = player->getPosition();
+        if (!isOnScreen(pos - weaponReach, pos + Vector2D(player->getWidth(), player->getHeight()) + weaponReach)) {
+            m_renderStats.culled++;
+            continue;
+        }
+        
+        m_renderStats.drawn++;
+        drawPlayer(painter, player);
     }
 }
 
 void GameWindow::drawPlayer(QPainter* painter, std::shared_ptr<Player> player) {
     Vector2D pos = player->getPosition();
-    QColor playerColor = player->getColor();
+    QColor playerColor = QColor::fromRgb(player->getColor());
     
     // If player is invisible, make it semi-transparent
     if (player->isInvisible()) {
@@ -223,9 +360,9 @@ void GameWindow::drawPlayer(QPainter* painter, std::shared_ptr<Player> player) {
     
     // Adjust drawing based on state
     if (player->getState() == PlayerState::CROUCHING) {
-        // Crouching state: reduce height, increase width
-        playerRect.setHeight(static_cast<int>(player->getHeight() * 0.6));
+        // Crouching state: reduce height, increase width (setY keeps the bottom edge, so it goes first)
         playerRect.setY(static_cast<int>(pos.y + player->getHeight() * 0.4));
+        playerRect.setHeight(static_cast<int>(player->getHeight() * 0.6));
         playerRect.setWidth(static_cast<int>(player->getWidth() * 1.2));
     }
     
@@ -240,109 +377,83 @@ void GameWindow::drawPlayer(QPainter* painter, std::shared_ptr<Player> player) {
     painter->drawEllipse(eyeX - 3, eyeY - 3, 6, 6);
     
     // Draw weapon
-    if (player->getWeapon()) {
-        painter->setPen(Qt::black);
-        painter->setBrush(player->getWeapon()->getColor());
-        
-        int weaponX = player->isFacingRight() ? 
-                     static_cast<int>(pos.x + player->getWidth()) : 
-                     static_cast<int>(pos.x - 15);
-        int weaponY = static_cast<int>(pos.y + player->getHeight() * 0.5);
-        
-        // Draw different shapes based on weapon type
-        switch (player->getWeapon()->getType()) {
-            case WeaponType::FIST:
-                painter->drawEllipse(weaponX - 5, weaponY - 5, 10, 10);
-                break;
-            case WeaponType::KNIFE:
-                painter->drawRect(weaponX - 2, weaponY - 8, 4, 16);
-                break;
-            case WeaponType::BALL:
-                painter->drawEllipse(weaponX - 6, weaponY - 6, 12, 12);
-                break;
-            case WeaponType::RIFLE:
-                painter->drawRect(weaponX - 15, weaponY - 3, 30, 6);
-                break;
-            case WeaponType::SNIPER:
-                painter->drawRect(weaponX - 20, weaponY - 4, 40, 8);
-                break;
-        }
+    painter->setPen(Qt::black);
+    painter->setBrush(QColor::fromRgb(player->getWeapon().getColor()));
+    
+    int weaponX = player->isFacingRight() ? 
+                 static_cast<int>(pos.x + player->getWidth()) : 
+                 static_cast<int>(pos.x - 15);
+    int weaponY = static_cast<int>(pos.y + player->getHeight() * 0.5);
+    
+    // Draw different shapes based on weapon type
+    switch (player->getWeapon().getType()) {
+        case WeaponType::FIST:
+            painter->drawEllipse(weaponX - 5, weaponY - 5, 10, 10);
+            break;
+        case WeaponType::KNIFE:
+            painter->drawRect(weaponX - 2, weaponY - 8, 4, 16);
+            break;
+        case WeaponType::BALL:
+            painter->drawEllipse(weaponX - 6, weaponY - 6, 12, 12);
+            break;
+        case WeaponType::RIFLE:
+            painter->drawRect(weaponX - 15, weaponY - 3, 30, 6);
+            break;
+        case WeaponType::SNIPER:
+            painter->drawRect(weaponX - 20, weaponY - 4, 40, 8);
+            break;
     }
 }
 
-void GameWindow::drawProjectiles(QPainter* painter) {
-    for (const auto& projectile : m_gameEngine->getProjectiles()) {
-        Vector2D pos = projectile->getPosition();
-        double radius = projectile->getRadius();
-        
-        painter->setPen(Qt::black);
-        
-        // Set color based on ammunition type
-        switch (projectile->getType()) {
-            case AmmoType::BULLET:
-                painter->setBrush(QColor(255, 255, 0)); // Yellow bullet
-                break;
-            case AmmoType::THROWN:
-                painter->setBrush(QColor(255, 165, 0)); // Orange projectile
-                break;
-            default:
-                painter->setBrush(Qt::red);
-                break;
+void GameWindow::drawEntities(QPainter* painter) {
+    const EntityWorld& world = m_gameEngine->getWorld();
+    
+    painter->setFont(QFont("Arial", 8));
+    
+    for (std::size_t i = 0; i < world.sprites.size(); ++i) {
+        const Bounds& box = world.bounds.get(world.sprites.entityAt(i));
+        if (!isOnScreen(box.min, box.max)) {
+            m_renderStats.culled++;
+            continue;
         }
+        m_renderStats.drawn++;
         
-        painter->drawEllipse(
-            static_cast<int>(pos.x - radius),
-            static_cast<int>(pos.y - radius),
-            static_cast<int>(radius * 2),
-            static_cast<int>(radius * 2)
-        );
-    }
-}
-
-void GameWindow::drawItems(QPainter* painter) {
-    for (const auto& item : m_gameEngine->getItems()) {
-        if (!item->isValid()) continue;
-        
-        Vector2D pos = item->getPosition();
+        const Sprite& sprite = world.sprites.at(i);
         painter->setPen(Qt::black);
-        painter->setBrush(item->getColor());
+        painter->setBrush(QColor::fromRgb(sprite.color));
         
-        QRect itemRect(
-            static_cast<int>(pos.x),
-            static_cast<int>(pos.y),
-            static_cast<int>(item->getWidth()),
-            static_cast<int>(item->getHeight())
+        QRect spriteRect(
+            static_cast<int>(box.min.x),
+            static_cast<int>(box.min.y),
+            static_cast<int>(box.max.x - box.min.x),
+            static_cast<int>(box.max.y - box.min.y)
         );
         
-        painter->drawRect(itemRect);
+        switch (sprite.shape) {
+            case SpriteShape::RECT:
+                painter->drawRect(spriteRect);
+                break;
+            case SpriteShape::ELLIPSE:
+                painter->drawEllipse(spriteRect.x(), spriteRect.y(), spriteRect.width(), spriteRect.height());
+                break;
+        }
         
         // Draw item type text
-        painter->setPen(Qt::white);
-        painter->setFont(QFont("Arial", 8));
-        
-        QString itemText;
-        switch (item->getType()) {
-            case ItemType::WEAPON_KNIFE: itemText = "K"; break;
-            case ItemType::WEAPON_BALL: itemText = "B"; break;
-            case ItemType::WEAPON_RIFLE: itemText = "R"; break;
-            case ItemType::WEAPON_SNIPER: itemText = "S"; break;
-            case ItemType::BANDAGE: itemText = "+"; break;
-            case ItemType::MEDKIT: itemText = "H"; break;
-            case ItemType::ADRENALINE: itemText = "A"; break;
+        if (sprite.label != 0) {
+            painter->setPen(Qt::white);
+            painter->drawText(spriteRect, Qt::AlignCenter, QString(QChar(sprite.label)));
         }
-        
-        painter->drawText(itemRect, Qt::AlignCenter, itemText);
     }
 }
 
 void GameWindow::drawUI(QPainter* painter) {
     // Draw player 1 info (top left)
-    drawHealthBar(painter, m_gameEngine->getPlayer1(), 20, 20, "Player 1 (ADWS+Space)");
-    drawWeaponInfo(painter, m_gameEngine->getPlayer1(), 20, 80);
+    drawHealthBar(painter, m_gameEngine->getPlayer(0), 20, 20, "Player 1 (ADWS+Space)");
+    drawWeaponInfo(painter, m_gameEngine->getPlayer(0), 20, 80);
     
     // Draw player 2 info (top right)
-    drawHealthBar(painter, m_gameEngine->getPlayer2(), width() - 220, 20, "Player 2 (JLIK+Shift)");
-    drawWeaponInfo(painter, m_gameEngine->getPlayer2(), width() - 220, 80);
+    drawHealthBar(painter, m_gameEngine->getPlayer(1), width() - 220, 20, "Player 2 (JLIK+Shift)");
+    drawWeaponInfo(painter, m_gameEngine->getPlayer(1), width() - 220, 80);
     
     // Draw game state
     painter->setPen(Qt::black);
@@ -362,6 +473,17 @@ void GameWindow::drawUI(QPainter* painter) {
     }
     
     painter->drawText(width()/2 - 100, height() - 30, stateText);
+    
+    // Draw frame rate and pacing statistics
+    drawFPS(painter);
+    
+    if (m_showLatencyOverlay) {
+        drawLatencyOverlay(painter);
+    }
+    
+    if (m_showAllocationOverlay) {
+        drawAllocationOverlay(painter);
+    }
 }
 
 void GameWindow::drawHealthBar(QPainter* painter, std::shared_ptr<Player> player, 
@@ -404,24 +526,24 @@ void GameWindow::drawHealthBar(QPainter* painter, std::shared_ptr<Player> player
 }
 
 void GameWindow::drawWeaponInfo(QPainter* painter, std::shared_ptr<Player> player, int x, int y) {
-    if (!player || !player->getWeapon()) return;
+    if (!player) return;
     
-    auto weapon = player->getWeapon();
+    const WeaponState& weapon = player->getWeapon();
     
     painter->setPen(Qt::black);
     painter->setFont(QFont("Arial", 10));
     
-    QString weaponName = getWeaponTypeName(weapon->getType());
+    QString weaponName = getWeaponTypeName(weapon.getType());
     QString weaponInfo = QString("Weapon: %1").arg(weaponName);
     
-    if (weapon->getAmmo() != -1) {
-        weaponInfo += QString(" (%1 ammo)").arg(weapon->getAmmo());
+    if (weapon.getAmmo() != -1) {
+        weaponInfo += QString(" (%1 ammo)").arg(weapon.getAmmo());
     }
     
     painter->drawText(x, y, weaponInfo);
     
     // Weapon color indicator
-    painter->setBrush(weapon->getColor());
+    painter->setBrush(QColor::fromRgb(weapon.getColor()));
     painter->drawRect(x, y + 5, 20, 10);
 }
 
@@ -434,12 +556,13 @@ void GameWindow::drawGameOver(QPainter* painter) {
     painter->setFont(QFont("Arial", 36, QFont::Bold));
     
     QString winnerText;
-    if (m_gameEngine->getWinner() == 1) {
-        winnerText = "Player 1 Wins!";
-    } else if (m_gameEngine->getWinner() == 2) {
-        winnerText = "Player 2 Wins!";
-    } else {
+    int winner = m_gameEngine->getWinner();
+    if (winner == 0) {
         winnerText = "Draw!";
+    } else if (m_gameEngine->getTeamCount() == m_gameEngine->getPlayerCount()) {
+        winnerText = QString("Player %1 Wins!").arg(winner);
+    } else {
+        winnerText = QString("Team %1 Wins!").arg(winner);
     }
     
     QRect textRect = rect();
@@ -454,8 +577,101 @@ void GameWindow::drawFPS(QPainter* painter) {
     painter->setPen(Qt::black);
     painter->setFont(QFont("Arial", 10));
     
-    QString fpsText = QString("FPS: %1").arg(static_cast<int>(m_currentFPS));
-    painter->drawText(width() - 80, height() - 10, fpsText);
+    QString fpsText = QString("FPS: %1 / %2Hz (F2)").arg(static_cast<int>(m_currentFPS)).arg(m_framePacer->getTargetHz());
+    painter->drawText(width() - 300, height() - 25, fpsText);
+    
+    QString pacingText = QString("Pacing error: avg %1ms, max %2ms, missed %3")
+                         .arg(m_framePacer->getAverageError(), 0, 'f', 2)
+                         .arg(m_framePacer->getMaxError(), 0, 'f', 2)
+                         .arg(m_framePacer->getMissedFrames());
+    painter->drawText(width() - 300, height() - 10, pacingText);
+    
+    QString cullingText = QString("Drawn: %1, culled: %2").arg(m_renderStats.drawn).arg(m_renderStats.culled);
+    painter->drawText(width() - 300, height() - 40, cullingText);
+}
+
+void GameWindow::drawLatencyOverlay(QPainter* painter) {
+    const int panelX = 20;
+    const int panelY = height() - 200;
+    const int panelWidth = 2 * (LatencyTracker::BUCKET_COUNT + 1) + 20;
+    const int panelHeight = 140;
+    
+    painter->fillRect(QRect(panelX, panelY, panelWidth, panelHeight), QColor(0, 0, 0, 160));
+    
+    // Histogram bars, scaled to the fullest bucket
+    const auto& histogram = m_latencyTracker.getHistogram();
+    long long maxCount = 1;
+    for (long long count : histogram) {
+        maxCount = std::max(maxCount, count);
+    }
+    
+    painter->setPen(Qt::NoPen);
+    painter->setBrush(QColor(255, 200, 0));
+    const int barBase = panelY + panelHeight - 10;
+    const int barMaxHeight = 80;
+    for (int i = 0; i <= LatencyTracker::BUCKET_COUNT; ++i) {
+        int barHeight = static_cast<int>(barMaxHeight * histogram[i] / maxCount);
+        if (barHeight > 0) {
+            painter->drawRect(panelX + 10 + i * 2, barBase - barHeight, 2, barHeight);
+        }
+    }
+    
+    // Summary statistics
+    painter->setPen(Qt::white);
+    painter->setFont(QFont("Arial", 9));
+    painter->drawText(panelX + 10, panelY + 15,
+                      QString("Input latency (F3 hide, F4 export)  n=%1").arg(m_latencyTracker.getSampleCount()));
+    painter->drawText(panelX + 10, panelY + 30,
+                      QString("mean %1  p50 %2  p95 %3  p99 %4  max %5 ms")
+                      .arg(m_latencyTracker.getMean(), 0, 'f', 1)
+                      .arg(m_latencyTracker.getPercentile(50), 0, 'f', 1)
+                      .arg(m_latencyTracker.getPercentile(95), 0, 'f', 1)
+                      .arg(m_latencyTracker.getPercentile(99), 0, 'f', 1)
+                      .arg(m_latencyTracker.getMax(), 0, 'f', 1));
+}
+
+void GameWindow::drawAllocationOverlay(QPainter* painter) {
+    const int panelWidth = 300;
+    const int panelX = width() - panelWidth - 20;
+    const int panelY = 130;
+    const int lineHeight = 15;
+    const AllocationSnapshot& frame = m_allocationTrace.getLastFrame();
+    
+    // One line per phase that allocated in the last frame
+    int phaseLines = 0;
+    for (const AllocationCounts& counts : frame) {
+        if (counts.allocations > 0) phaseLines++;
+    }
+    int panelHeight = (3 + phaseLines) * lineHeight + 10;
+    painter->fillRect(QRect(panelX, panelY, panelWidth, panelHeight), QColor(0, 0, 0, 160));
+    
+    painter->setPen(Qt::white);
+    painter->setFont(QFont("Arial", 9));
+    int y = panelY + lineHeight;
+    painter->drawText(panelX + 10, y, "Heap allocations per frame (F5 hide, F6 export)");
+    y += lineHeight;
+    if (!AllocationTracker::isEnabled()) {
+        painter->drawText(panelX + 10, y, "Off: configure with -DQTGAME_ALLOC_TRACKING=ON");
+        return;
+    }
+    
+    AllocationCounts tick = AllocationTracker::sum(frame, AllocationPhase::TICK_TIMERS, AllocationPhase::TICK_GAME_OVER);
+    AllocationCounts render = AllocationTracker::sum(frame, AllocationPhase::RENDER_WORLD, AllocationPhase::RENDER_HUD);
+    painter->drawText(panelX + 10, y, QString("tick %1 (%2 B)  render %3 (%4 B)")
+                      .arg(tick.allocations).arg(tick.bytes).arg(render.allocations).arg(render.bytes));
+    y += lineHeight;
+    painter->drawText(panelX + 10, y, QString("other %1  frames %2")
+                      .arg(frame[static_cast<std::size_t>(AllocationPhase::OTHER)].allocations)
+                      .arg(m_allocationTrace.getFrameCount()));
+    
+    painter->setPen(QColor(255, 200, 0));
+    for (std::size_t i = 0; i < frame.size(); ++i) {
+        if (frame[i].allocations == 0) continue;
+        y += lineHeight;
+        painter->drawText(panelX + 10, y, QString("%1: %2 (%3 B)")
+                          .arg(AllocationTracker::getPhaseName(static_cast<AllocationPhase>(i)))
+                          .arg(frame[i].allocations).arg(frame[i].bytes));
+    }
 }
 
 void GameWindow::updateFPS() {
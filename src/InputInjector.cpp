@@ -0,0 +1,62 @@
+/**
+ * @file InputInjector.cpp
+ * @brief Synthetic input injector class implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "InputInjector.h"
+#include "GameConfig.h"
+#include <QCoreApplication>
+#include <QKeyEvent>
+#include <QWidget>
+
+namespace {
+    // Keys cycled through by the injector, covering movement and jumps of both players
+    const Qt::Key INJECTED_KEYS[] = {
+        GameConfig::PLAYER1_LEFT, GameConfig::PLAYER1_RIGHT, GameConfig::PLAYER1_JUMP,
+        GameConfig::PLAYER2_LEFT, GameConfig::PLAYER2_RIGHT, GameConfig::PLAYER2_JUMP
+    };
+    const int INJECTED_KEY_COUNT = sizeof(INJECTED_KEYS) / sizeof(INJECTED_KEYS[0]);
+}
+
+InputInjector::InputInjector(QWidget* target, int pressCount, int intervalMs, QObject* parent)
+    : QObject(parent), m_target(target), m_pressCount(pressCount), m_injected(0),
+      m_intervalMs(intervalMs), m_heldKey(0), m_randomGenerator(12345) {
+    
+    m_timer = new QTimer(this);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    m_timer->setSingleShot(true);
+    connect(m_timer, &QTimer::timeout, this, &InputInjector::injectNext);
+}
+
+void InputInjector::start() {
+    m_injected = 0;
+    m_timer->start(m_intervalMs);
+}
+
+void InputInjector::injectNext() {
+    // Release the previously held key
+    if (m_heldKey != 0) {
+        postKey(m_heldKey, false);
+        m_heldKey = 0;
+    }
+    
+    if (m_injected >= m_pressCount) {
+        emit finished();
+        return;
+    }
+    
+    m_heldKey = INJECTED_KEYS[m_injected % INJECTED_KEY_COUNT];
+    postKey(m_heldKey, true);
+    m_injected++;
+    
+    // Jitter the interval so presses land at every phase of the frame
+    std::uniform_int_distribution<int> jitter(0, m_intervalMs);
+    m_timer->start(m_intervalMs + jitter(m_randomGenerator));
+}
+
+void InputInjector::postKey(int key, bool pressed) {
+    QCoreApplication::postEvent(m_target, new QKeyEvent(pressed ? QEvent::KeyPress : QEvent::KeyRelease,
+                                                        key, Qt::NoModifier));
+}
@@ -0,0 +1,76 @@
+/**
+ * @file InputQueue.cpp
+ * @brief Input event queue and key binding table implementations
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "InputQueue.h"
+#include "GameConfig.h"
+
+// ======================== InputQueue class implementation ========================
+
+InputQueue::InputQueue() : m_head(0), m_tail(0), m_dropped(0) {
+}
+
+bool InputQueue::push(const InputEvent& event) {
+    if (m_tail - m_head >= static_cast<unsigned int>(CAPACITY)) {
+        m_dropped++;
+        return false;
+    }
+    
+    m_events[m_tail & (CAPACITY - 1)] = event;
+    m_tail++;
+    return true;
+}
+
+bool InputQueue::pop(InputEvent& event) {
+    if (isEmpty()) {
+        return false;
+    }
+    
+    event = m_events[m_head & (CAPACITY - 1)];
+    m_head++;
+    return true;
+}
+
+void InputQueue::clear() {
+    m_head = m_tail;
+}
+
+// ======================== KeyBindings class implementation ========================
+
+KeyBindings::KeyBindings() {
+    m_table.fill(Binding{-1, -1, Action::NONE});
+    
+    // Player 1
+    bind(GameConfig::PLAYER1_LEFT, 0, Action::LEFT);
+    bind(GameConfig::PLAYER1_RIGHT, 0, Action::RIGHT);
+    bind(GameConfig::PLAYER1_JUMP, 0, Action::JUMP);
+    bind(GameConfig::PLAYER1_CROUCH, 0, Action::CROUCH);
+    bind(GameConfig::PLAYER1_FIRE, 0, Action::FIRE);
+    
+    // Player 2
+    bind(GameConfig::PLAYER2_LEFT, 1, Action::LEFT);
+    bind(GameConfig::PLAYER2_RIGHT, 1, Action::RIGHT);
+    bind(GameConfig::PLAYER2_JUMP, 1, Action::JUMP);
+    bind(GameConfig::PLAYER2_CROUCH, 1, Action::CROUCH);
+    bind(GameConfig::PLAYER2_FIRE, 1, Action::FIRE);
+}
+
+void KeyBindings::bind(Qt::Key key, int playerIndex, ActionMask action) {
+    Binding& binding = m_table[slotFor(key)];
+    // Slots are direct-mapped; two bound keys must not share one
+    Q_ASSERT(binding.key == -1 || binding.key == key);
+    binding = Binding{key, playerIndex, action};
+}
+
+const KeyBindings::Binding* KeyBindings::lookup(Qt::Key key) const {
+    const Binding& binding = m_table[slotFor(key)];
+    return binding.key == key ? &binding : nullptr;
+}
+
+int KeyBindings::slotFor(int key) {
+    // Printable keys keep their Latin-1 code, special keys (0x01xxxxxx) use the upper half
+    return (key & 0x7F) | ((key & 0x01000000) ? 0x80 : 0);
+}
@@ -0,0 +1,89 @@
+/**
+ * @file JobSystem.cpp
+ * @brief Job system implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "JobSystem.h"
+
+JobSystem::JobSystem(int threads)
+    : m_threadCount(threads > 0 ? threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()))),
+      m_stopping(false) {
+    m_queue.reserve(static_cast<std::size_t>(m_threadCount) * 4);
+    for (int thread = 1; thread < m_threadCount; ++thread) {
+        m_threads.emplace_back(&JobSystem::workerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void JobSystem::run(std::size_t count, std::size_t chunks, JobFunction function, void* job) {
+    int remaining = static_cast<int>(chunks);
+    AllocationPhase phase = AllocationTracker::getPhase();
+    {
+        // Queued back to front, so the tasks taken first from the back are the early chunks
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (std::size_t chunk = chunks - 1; chunk >= 1; --chunk) {
+            m_queue.push_back(Task{function, job, chunk, count * chunk / chunks, count * (chunk + 1) / chunks,
+                                   &remaining, phase});
+        }
+    }
+    m_wake.notify_all();
+    
+    execute(Task{function, job, 0, 0, count / chunks, &remaining, phase});
+    
+    // Help with queued tasks, ours or those of nested calls, until every chunk of this call is done
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (remaining > 0) {
+        if (m_queue.empty()) {
+            m_wake.wait(lock);
+            continue;
+        }
+        Task task = m_queue.back();
+        m_queue.pop_back();
+        lock.unlock();
+        execute(task);
+        lock.lock();
+    }
+}
+
+void JobSystem::execute(const Task& task) {
+    {
+        // Allocations of the chunk count against the phase that queued it
+        AllocationTracker::Scope scope(task.phase);
+        task.function(task.job, task.chunk, task.begin, task.end);
+    }
+    
+    bool last;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        last = --*task.remaining == 0;
+    }
+    if (last) {
+        m_wake.notify_all();
+    }
+}
+
+void JobSystem::workerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+        if (m_stopping) return;
+        
+        Task task = m_queue.back();
+        m_queue.pop_back();
+        lock.unlock();
+        execute(task);
+        lock.lock();
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file LatencyTracker.cpp
+ * @brief Input-to-photon latency tracker class implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "LatencyTracker.h"
+#include <QFile>
+#include <QTextStream>
+#include <algorithm>
+#include <chrono>
+
+LatencyTracker::LatencyTracker() {
+    reset();
+}
+
+long long LatencyTracker::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void LatencyTracker::recordConsumed(long long inputTimestamp, long long tickTimestamp) {
+    if (m_pendingCount >= PENDING_CAPACITY) return; // No frame presented for a long time, drop
+    
+    m_pending[m_pendingCount++] = PendingEvent{inputTimestamp, tickTimestamp};
+}
+
+void LatencyTracker::recordPresented(long long presentTimestamp) {
+    for (int i = 0; i < m_pendingCount; ++i) {
+        const PendingEvent& event = m_pending[i];
+        double totalMs = (presentTimestamp - event.inputTimestamp) / 1000000.0;
+        double queueMs = (event.tickTimestamp - event.inputTimestamp) / 1000000.0;
+        
+        int bucket = static_cast<int>(totalMs / BUCKET_WIDTH_MS);
+        bucket = std::max(0, std::min(bucket, BUCKET_COUNT));
+        m_histogram[bucket]++;
+        
+        m_sampleCount++;
+        m_totalSum += totalMs;
+        m_queueSum += queueMs;
+        m_min = std::min(m_min, totalMs);
+        m_max = std::max(m_max, totalMs);
+    }
+    
+    m_pendingCount = 0;
+}
+
+void LatencyTracker::reset() {
+    m_pendingCount = 0;
+    m_histogram.fill(0);
+    m_sampleCount = 0;
+    m_totalSum = 0.0;
+    m_queueSum = 0.0;
+    m_min = 1e30;
+    m_max = 0.0;
+}
+
+double LatencyTracker::getPercentile(double percentile) const {
+    if (m_sampleCount == 0) return 0.0;
+    
+    long long target = static_cast<long long>(percentile / 100.0 * (m_sampleCount - 1));
+    long long seen = 0;
+    for (int i = 0; i <= BUCKET_COUNT; ++i) {
+        seen += m_histogram[i];
+        if (seen > target) {
+            // The overflow bucket has no upper edge; the largest sample bounds it
+            if (i == BUCKET_COUNT) return m_max;
+            
+            // Report the bucket's upper edge, clamped to the observed range
+            return std::min(m_max, (i + 1) * BUCKET_WIDTH_MS);
+        }
+    }
+    return m_max;
+}
+
+bool LatencyTracker::exportStatistics(const QString& path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        return false;
+    }
+    
+    QTextStream out(&file);
+    out << "# QtGame input-to-photon latency statistics (milliseconds)\n";
+    out << "samples," << m_sampleCount << "\n";
+    out << "mean," << getMean() << "\n";
+    out << "min," << getMin() << "\n";
+    out << "p50," << getPercentile(50) << "\n";
+    out << "p95," << getPercentile(95) << "\n";
+    out << "p99," << getPercentile(99) << "\n";
+    out << "max," << getMax() << "\n";
+    out << "mean_input_to_tick," << getMeanQueueDelay() << "\n";
+    out << "\n";
+    out << "bucket_start_ms,count\n";
+    for (int i = 0; i <= BUCKET_COUNT; ++i) {
+        out << i * BUCKET_WIDTH_MS << "," << m_histogram[i] << "\n";
+    }
+    
+    return true;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file Level.cpp
+ * @brief Level class implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "Level.h"
+#include "LevelBaker.h"
+#include "GameConfig.h"
+#include <QFile>
+#include <cmath>
+
+Level::Level()
+    : m_header(nullptr), m_platforms(nullptr), m_spawns(nullptr), m_chunks(nullptr), m_cells(nullptr),
+      m_indices(nullptr), m_columns(nullptr), m_surfaces(nullptr) {
+    loadBuiltin();
+}
+
+Level::~Level() = default;
+
+bool Level::load(const QString& path, QString* error) {
+    QString message;
+    auto file = std::make_unique<QFile>(path);
+    
+    if (!file->open(QIODevice::ReadOnly)) {
+        message = file->errorString();
+    } else {
+        const unsigned char* data = file->map(0, file->size());
+        if (!data) {
+            message = file->errorString();
+        } else if (bind(data, static_cast<std::size_t>(file->size()), message)) {
+            // Section pointers now refer to the new mapping, release the old image
+            m_file = std::move(file);
+            m_buffer.clear();
+            m_buffer.shrink_to_fit();
+            return true;
+        }
+    }
+    
+    if (error) *error = path + ": " + message;
+    return false;
+}
+
+void Level::loadBuiltin() {
+    // Same layout as levels/arena.txt
+    LevelBaker baker;
+    baker.setWorldSize(GameConfig::WINDOW_WIDTH, GameConfig::WINDOW_HEIGHT);
+    
+    const float ground = static_cast<float>(GameConfig::GROUND_LEVEL);
+    baker.addPlatform({0, ground, GameConfig::WINDOW_WIDTH, 50, LevelFormat::TERRAIN_GROUND, 0x8B4513});
+    baker.addPlatform({450, 600, 300, 20, LevelFormat::TERRAIN_GRASS, 0x228B22});
+    baker.addPlatform({100, 500, 200, 20, LevelFormat::TERRAIN_ICE, 0xADD8E6});
+    baker.addPlatform({900, 500, 200, 20, LevelFormat::TERRAIN_GROUND, 0x8B4513});
+    baker.addPlatform({350, 400, 400, 20, LevelFormat::TERRAIN_ICE, 0xADD8E6});
+    baker.addPlatform({50, 300, 150, 20, LevelFormat::TERRAIN_GRASS, 0x228B22});
+    baker.addPlatform({1000, 300, 150, 20, LevelFormat::TERRAIN_GRASS, 0x228B22});
+    
+    const float spawnY = ground - static_cast<float>(GameConfig::PLAYER_HEIGHT);
+    baker.addSpawn({200, spawnY});
+    baker.addSpawn({1000, spawnY});
+    
+    std::vector<unsigned char> buffer;
+    std::string bakeError;
+    bool baked = baker.bake(buffer, bakeError);
+    Q_ASSERT(baked);
+    Q_UNUSED(baked);
+    QString message;
+    bind(buffer.data(), buffer.size(), message);
+    Q_ASSERT(message.isEmpty());
+    
+    // Moving the vector keeps its storage, so the section pointers stay valid
+    m_buffer = std::move(buffer);
+    m_file.reset();
+}
+
+bool Level::bind(const unsigned char* data, std::size_t size, QString& error) {
+    using namespace LevelFormat;
+    
+    if (size < sizeof(Header)) {
+        error = QStringLiteral("file too small");
+        return false;
+    }
+    
+    const Header* header = reinterpret_cast<const Header*>(data);
+    if (header->magic != MAGIC) {
+        error = QStringLiteral("not a level file");
+        return false;
+    }
+    if (header->version != VERSION) {
+        error = QStringLiteral("unsupported version %1").arg(header->version);
+        return false;
+    }
+    // Negated comparisons also reject NaN
+    if (!(header->worldWidth > 0) || !(header->worldHeight > 0) || !(header->chunkSize > 0) ||
+        !std::isfinite(header->worldWidth) || !std::isfinite(header->worldHeight) || !std::isfinite(header->chunkSize)) {
+        error = QStringLiteral("invalid world or chunk size");
+        return false;
+    }
+    
+    // The caps keep every chunk, cell and column count below 2^40, so the products cannot overflow
+    if (header->chunkColumns == 0 || header->chunkColumns > MAX_CHUNKS_PER_AXIS ||
+        header->chunkRows == 0 || header->chunkRows > MAX_CHUNKS_PER_AXIS ||
+        header->cellsPerChunk == 0 || header->cellsPerChunk > MAX_CELLS_PER_CHUNK ||
+        header->columnsPerChunk == 0 || header->columnsPerChunk > MAX_COLUMNS_PER_CHUNK) {
+        error = QStringLiteral("invalid chunk grid");
+        return false;
+    }
+    
+    // Every section must be aligned and lie inside the file; dividing the remaining size keeps
+    // huge counts from wrapping
+    auto sectionFits = [size](std::uint32_t offset, std::uint64_t count, std::size_t recordSize) {
+        return offset % 4 == 0 && offset <= size && count <= (size - offset) / recordSize;
+    };
+    std::uint64_t chunkCount = static_cast<std::uint64_t>(header->chunkColumns) * header->chunkRows;
+    std::uint64_t cellCount = chunkCount * header->cellsPerChunk * header->cellsPerChunk;
+    if (!sectionFits(header->platformOffset, header->platformCount, sizeof(PlatformRecord)) ||
+        !sectionFits(header->spawnOffset, header->spawnCount, sizeof(SpawnRecord)) ||
+        !sectionFits(header->chunkOffset, chunkCount, sizeof(ChunkRecord)) ||
+        !sectionFits(header->gridCellOffset, cellCount, sizeof(GridCell)) ||
+        !sectionFits(header->indexOffset, header->indexCount, sizeof(std::uint32_t)) ||
+        !sectionFits(header->columnOffset, chunkCount * header->columnsPerChunk, sizeof(SurfaceColumn)) ||
+        !sectionFits(header->surfaceOffset, header->surfaceCount, sizeof(SurfaceRecord))) {
+        error = QStringLiteral("truncated section");
+        return false;
+    }
+    if (header->spawnCount < 2) {
+        error = QStringLiteral("level needs at least two spawn points");
+        return false;
+    }
+    
+    // Chunk contents are checked by isChunkValid() when a chunk is paged in
+    const ChunkRecord* chunks = reinterpret_cast<const ChunkRecord*>(data + header->chunkOffset);
+    const GridCell* cells = reinterpret_cast<const GridCell*>(data + header->gridCellOffset);
+    const std::uint32_t* indices = reinterpret_cast<const std::uint32_t*>(data + header->indexOffset);
+    
+    m_header = header;
+    m_platforms = reinterpret_cast<const PlatformRecord*>(data + header->platformOffset);
+    m_spawns = reinterpret_cast<const SpawnRecord*>(data + header->spawnOffset);
+    m_chunks = chunks;
+    m_cells = cells;
+    m_indices = indices;
+    m_columns = reinterpret_cast<const SurfaceColumn*>(data + header->columnOffset);
+    m_surfaces = reinterpret_cast<const SurfaceRecord*>(data + header->surfaceOffset);
+    return true;
+}
+
+bool Level::isChunkValid(std::uint32_t chunk) const {
+    auto rangeFits = [this](std::uint32_t first, std::uint32_t count) {
+        if (static_cast<std::uint64_t>(first) + count > m_header->indexCount) return false;
+        for (std::uint32_t i = first; i < first + count; ++i) {
+            if (m_indices[i] >= m_header->platformCount) return false;
+        }
+        return true;
+    };
+    
+    if (chunk >= static_cast<std::uint64_t>(m_header->chunkColumns) * m_header->chunkRows) return false;
+    if (!rangeFits(m_chunks[chunk].first, m_chunks[chunk].count)) return false;
+    
+    const LevelFormat::GridCell* cells = getChunkCells(chunk);
+    std::uint32_t cellCount = m_header->cellsPerChunk * m_header->cellsPerChunk;
+    for (std::uint32_t c = 0; c < cellCount; ++c) {
+        if (!rangeFits(cells[c].first, cells[c].count)) return false;
+    }
+    
+    // Surface columns must be sorted, surface queries binary search them
+    const LevelFormat::SurfaceColumn* columns = getChunkSurfaceColumns(chunk);
+    for (std::uint32_t c = 0; c < m_header->columnsPerChunk; ++c) {
+        const LevelFormat::SurfaceColumn& column = columns[c];
+        if (static_cast<std::uint64_t>(column.first) + column.count > m_header->surfaceCount) return false;
+        for (std::uint32_t i = column.first; i < column.first + column.count; ++i) {
+            if (m_surfaces[i].platform >= m_header->platformCount) return false;
+            if (i > column.first && !(m_surfaces[i - 1].top <= m_surfaces[i].top)) return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,351 @@
+/**
+ * @file LevelBaker.cpp
+ * @brief Level baker class implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "LevelBaker.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+LevelBaker::LevelBaker() : m_worldWidth(1200.0f), m_worldHeight(800.0f), m_chunkSize(512.0f), m_cellSize(128.0f),
+      m_columnSize(64.0f) {
+}
+
+void LevelBaker::setWorldSize(float width, float height) {
+    m_worldWidth = width;
+    m_worldHeight = height;
+}
+
+void LevelBaker::setChunkSize(float size) {
+    m_chunkSize = size;
+}
+
+void LevelBaker::setCellSize(float size) {
+    m_cellSize = size;
+}
+
+void LevelBaker::setColumnSize(float size) {
+    m_columnSize = size;
+}
+
+void LevelBaker::addPlatform(const LevelFormat::PlatformRecord& record) {
+    m_platforms.push_back(record);
+}
+
+void LevelBaker::addSpawn(const LevelFormat::SpawnRecord& record) {
+    m_spawns.push_back(record);
+}
+
+bool LevelBaker::parseText(const std::string& source, std::string& error) {
+    std::istringstream input(source);
+    std::string line;
+    int lineNumber = 0;
+    int worldLine = 0, chunkLine = 0, cellLine = 0, columnLine = 0;
+    
+    while (std::getline(input, line)) {
+        lineNumber++;
+        
+        // Skip blank lines and comments
+        std::istringstream tokens(line);
+        std::string directive;
+        if (!(tokens >> directive) || directive[0] == '#') continue;
+        
+        if (directive == "world") {
+            if (!(tokens >> m_worldWidth >> m_worldHeight) || m_worldWidth <= 0 || m_worldHeight <= 0) {
+                error = "line " + std::to_string(lineNumber) + ": expected 'world <width> <height>'";
+                return false;
+            }
+            worldLine = lineNumber;
+        } else if (directive == "chunk") {
+            if (!(tokens >> m_chunkSize) || m_chunkSize <= 0) {
+                error = "line " + std::to_string(lineNumber) + ": expected 'chunk <size>'";
+                return false;
+            }
+            chunkLine = lineNumber;
+        } else if (directive == "cell") {
+            if (!(tokens >> m_cellSize) || m_cellSize <= 0) {
+                error = "line " + std::to_string(lineNumber) + ": expected 'cell <size>'";
+                return false;
+            }
+            cellLine = lineNumber;
+        } else if (directive == "column") {
+            if (!(tokens >> m_columnSize) || m_columnSize <= 0) {
+                error = "line " + std::to_string(lineNumber) + ": expected 'column <size>'";
+                return false;
+            }
+            columnLine = lineNumber;
+        } else if (directive == "platform") {
+            LevelFormat::PlatformRecord record{};
+            std::string terrain;
+            if (!(tokens >> record.x >> record.y >> record.width >> record.height >> terrain)) {
+                error = "line " + std::to_string(lineNumber) + ": expected 'platform <x> <y> <w> <h> <terrain> [#rrggbb]'";
+                return false;
+            }
+            
+            if (terrain == "ground") {
+                record.terrain = LevelFormat::TERRAIN_GROUND;
+            } else if (terrain == "grass") {
+                record.terrain = LevelFormat::TERRAIN_GRASS;
+            } else if (terrain == "ice") {
+                record.terrain = LevelFormat::TERRAIN_ICE;
+            } else {
+                error = "line " + std::to_string(lineNumber) + ": unknown terrain '" + terrain + "'";
+                return false;
+            }
+            
+            // Optional color after the terrain, e.g. #22aa22
+            record.color = defaultTerrainColor(record.terrain);
+            std::string color;
+            if (tokens >> color) {
+                if (color.size() != 7 || color[0] != '#' ||
+                    color.find_first_not_of("0123456789abcdefABCDEF", 1) != std::string::npos) {
+                    error = "line " + std::to_string(lineNumber) + ": invalid color '" + color + "'";
+                    return false;
+                }
+                record.color = static_cast<std::uint32_t>(std::stoul(color.substr(1), nullptr, 16));
+            }
+            
+            addPlatform(record);
+        } else if (directive == "spawn") {
+            LevelFormat::SpawnRecord record{};
+            if (!(tokens >> record.x >> record.y)) {
+                error = "line " + std::to_string(lineNumber) + ": expected 'spawn <x> <y>'";
+                return false;
+            }
+            addSpawn(record);
+        } else {
+            error = "line " + std::to_string(lineNumber) + ": unknown directive '" + directive + "'";
+            return false;
+        }
+    }
+    
+    // Directives may come in any order, so the grid is checked once all sizes are known
+    return checkGrid(error, std::max(worldLine, chunkLine), std::max(chunkLine, cellLine),
+                     std::max(chunkLine, columnLine));
+}
+
+bool LevelBaker::checkGrid(std::string& error, int chunkLine, int cellLine, int columnLine) const {
+    using namespace LevelFormat;
+    
+    auto fail = [&](int line, float count, const char* what, std::uint32_t limit, const char* fix) {
+        std::ostringstream message;
+        if (line > 0) message << "line " << line << ": ";
+        message << count << " " << what << " exceed the limit of " << limit << "; use a larger " << fix;
+        error = message.str();
+        return false;
+    };
+    
+    // Sizes given through the setters are not checked on the way in
+    auto positive = [](float value) { return value > 0 && std::isfinite(value); };
+    if (!positive(m_worldWidth) || !positive(m_worldHeight) || !positive(m_chunkSize) ||
+        !positive(m_cellSize) || !positive(m_columnSize)) {
+        error = "world, chunk, cell and column sizes must be positive";
+        return false;
+    }
+    
+    // Same expressions as bake(); an overflow to infinity fails the comparisons as well
+    float chunkColumns = std::ceil(m_worldWidth / m_chunkSize);
+    float chunkRows = std::ceil(m_worldHeight / m_chunkSize);
+    if (chunkColumns > MAX_CHUNKS_PER_AXIS || chunkRows > MAX_CHUNKS_PER_AXIS) {
+        return fail(chunkLine, std::max(chunkColumns, chunkRows), "chunks per axis", MAX_CHUNKS_PER_AXIS, "chunk size");
+    }
+    float cellsPerChunk = std::round(m_chunkSize / m_cellSize);
+    if (cellsPerChunk > MAX_CELLS_PER_CHUNK) {
+        return fail(cellLine, cellsPerChunk, "grid cells per chunk edge", MAX_CELLS_PER_CHUNK, "cell size");
+    }
+    float columnsPerChunk = std::round(m_chunkSize / m_columnSize);
+    if (columnsPerChunk > MAX_COLUMNS_PER_CHUNK) {
+        return fail(columnLine, columnsPerChunk, "surface columns per chunk", MAX_COLUMNS_PER_CHUNK, "column size");
+    }
+    return true;
+}
+
+bool LevelBaker::bake(std::vector<unsigned char>& data, std::string& error) const {
+    using namespace LevelFormat;
+    
+    if (!checkGrid(error)) return false;
+    
+    // Chunk grid; the cell size is snapped so that cells tile a chunk exactly
+    std::uint32_t chunkColumns = std::max(1u, static_cast<std::uint32_t>(std::ceil(m_worldWidth / m_chunkSize)));
+    std::uint32_t chunkRows = std::max(1u, static_cast<std::uint32_t>(std::ceil(m_worldHeight / m_chunkSize)));
+    std::uint32_t cellsPerChunk = std::max(1u, static_cast<std::uint32_t>(std::lround(m_chunkSize / m_cellSize)));
+    float cellSize = m_chunkSize / static_cast<float>(cellsPerChunk);
+    int lastCellX = static_cast<int>(chunkColumns * cellsPerChunk) - 1;
+    int lastCellY = static_cast<int>(chunkRows * cellsPerChunk) - 1;
+    
+    // Global cell range covered by a platform; platforms reaching outside the world
+    // are kept in the border cells
+    struct CellRange { int minX, maxX, minY, maxY; };
+    auto cellRangeOf = [&](const PlatformRecord& p) {
+        return CellRange{
+            std::clamp(static_cast<int>(std::floor(p.x / cellSize)), 0, lastCellX),
+            std::clamp(static_cast<int>(std::floor((p.x + p.width) / cellSize)), 0, lastCellX),
+            std::clamp(static_cast<int>(std::floor(p.y / cellSize)), 0, lastCellY),
+            std::clamp(static_cast<int>(std::floor((p.y + p.height) / cellSize)), 0, lastCellY)
+        };
+    };
+    int perChunk = static_cast<int>(cellsPerChunk);
+    std::uint32_t columnsPerChunk = std::max(1u, static_cast<std::uint32_t>(std::lround(m_chunkSize / m_columnSize)));
+    
+    // Offsets are 32-bit, so the file must stay below 4 GiB; the grid sections are checked
+    // before they are allocated, the index and surface sections once they are known
+    const std::uint64_t maxSize = std::numeric_limits<std::uint32_t>::max();
+    std::uint64_t chunkCount = static_cast<std::uint64_t>(chunkColumns) * chunkRows;
+    std::uint64_t chunkBytes = sizeof(ChunkRecord) + static_cast<std::uint64_t>(cellsPerChunk) * cellsPerChunk * sizeof(GridCell) +
+                               columnsPerChunk * sizeof(SurfaceColumn);
+    std::uint64_t fixedSize = sizeof(Header) + m_platforms.size() * sizeof(PlatformRecord) +
+                              m_spawns.size() * sizeof(SpawnRecord) + chunkCount * chunkBytes;
+    if (fixedSize > maxSize) {
+        error = "level file would reach 4 GiB";
+        return false;
+    }
+    
+    // Store platforms grouped by the chunk holding their top-left corner
+    std::vector<PlatformRecord> platforms(m_platforms);
+    std::stable_sort(platforms.begin(), platforms.end(), [&](const PlatformRecord& a, const PlatformRecord& b) {
+        CellRange ra = cellRangeOf(a);
+        CellRange rb = cellRangeOf(b);
+        int chunkA = (ra.minY / perChunk) * static_cast<int>(chunkColumns) + ra.minX / perChunk;
+        int chunkB = (rb.minY / perChunk) * static_cast<int>(chunkColumns) + rb.minX / perChunk;
+        return chunkA < chunkB;
+    });
+    
+    // Every chunk lists the platforms overlapping it
+    std::vector<std::vector<std::uint32_t>> chunkLists(chunkColumns * chunkRows);
+    for (std::uint32_t i = 0; i < platforms.size(); ++i) {
+        CellRange range = cellRangeOf(platforms[i]);
+        for (int cy = range.minY / perChunk; cy <= range.maxY / perChunk; ++cy) {
+            for (int cx = range.minX / perChunk; cx <= range.maxX / perChunk; ++cx) {
+                chunkLists[cy * chunkColumns + cx].push_back(i);
+            }
+        }
+    }
+    
+    // Emit chunk lists and chunk-local grids chunk by chunk
+    std::vector<ChunkRecord> chunks(chunkLists.size());
+    std::vector<GridCell> cells(chunkLists.size() * cellsPerChunk * cellsPerChunk);
+    std::vector<std::uint32_t> indices;
+    for (std::uint32_t c = 0; c < chunkLists.size(); ++c) {
+        const std::vector<std::uint32_t>& list = chunkLists[c];
+        chunks[c].first = static_cast<std::uint32_t>(indices.size());
+        chunks[c].count = static_cast<std::uint32_t>(list.size());
+        indices.insert(indices.end(), list.begin(), list.end());
+        
+        int originX = static_cast<int>(c % chunkColumns) * perChunk;
+        int originY = static_cast<int>(c / chunkColumns) * perChunk;
+        GridCell* chunkCells = &cells[c * cellsPerChunk * cellsPerChunk];
+        
+        for (int ly = 0; ly < perChunk; ++ly) {
+            for (int lx = 0; lx < perChunk; ++lx) {
+                GridCell& cell = chunkCells[ly * perChunk + lx];
+                cell.first = static_cast<std::uint32_t>(indices.size());
+                for (std::uint32_t platform : list) {
+                    CellRange range = cellRangeOf(platforms[platform]);
+                    if (originX + lx >= range.minX && originX + lx <= range.maxX &&
+                        originY + ly >= range.minY && originY + ly <= range.maxY) {
+                        indices.push_back(platform);
+                    }
+                }
+                cell.count = static_cast<std::uint32_t>(indices.size()) - cell.first;
+            }
+        }
+    }
+    
+    // Surface tables: a top edge belongs to the chunk containing it and is listed in every
+    // column of that chunk it spans, highest first
+    float columnSize = m_chunkSize / static_cast<float>(columnsPerChunk);
+    int perChunkColumns = static_cast<int>(columnsPerChunk);
+    int lastColumn = static_cast<int>(chunkColumns * columnsPerChunk) - 1;
+    std::vector<SurfaceColumn> columns(chunkLists.size() * columnsPerChunk);
+    std::vector<SurfaceRecord> surfaces;
+    std::vector<SurfaceRecord> columnSurfaces;
+    for (std::uint32_t c = 0; c < chunkLists.size(); ++c) {
+        int chunkX = static_cast<int>(c % chunkColumns);
+        int chunkY = static_cast<int>(c / chunkColumns);
+        SurfaceColumn* chunkColumnsOut = &columns[c * columnsPerChunk];
+        
+        for (int lx = 0; lx < perChunkColumns; ++lx) {
+            int column = chunkX * perChunkColumns + lx;
+            columnSurfaces.clear();
+            for (std::uint32_t platform : chunkLists[c]) {
+                const PlatformRecord& p = platforms[platform];
+                if (cellRangeOf(p).minY / perChunk != chunkY) continue;
+                
+                int minColumn = std::clamp(static_cast<int>(std::floor(p.x / columnSize)), 0, lastColumn);
+                int maxColumn = std::clamp(static_cast<int>(std::floor((p.x + p.width) / columnSize)), 0, lastColumn);
+                if (column >= minColumn && column <= maxColumn) {
+                    columnSurfaces.push_back(SurfaceRecord{p.y, p.x, p.x + p.width, platform});
+                }
+            }
+            std::sort(columnSurfaces.begin(), columnSurfaces.end(), [](const SurfaceRecord& a, const SurfaceRecord& b) {
+                return a.top < b.top || (a.top == b.top && a.platform < b.platform);
+            });
+            
+            chunkColumnsOut[lx].first = static_cast<std::uint32_t>(surfaces.size());
+            chunkColumnsOut[lx].count = static_cast<std::uint32_t>(columnSurfaces.size());
+            surfaces.insert(surfaces.end(), columnSurfaces.begin(), columnSurfaces.end());
+        }
+    }
+    
+    if (fixedSize + indices.size() * sizeof(std::uint32_t) + surfaces.size() * sizeof(SurfaceRecord) > maxSize) {
+        error = "level file would reach 4 GiB";
+        return false;
+    }
+    
+    // Lay out sections back to back after the header
+    Header header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.worldWidth = m_worldWidth;
+    header.worldHeight = m_worldHeight;
+    header.platformCount = static_cast<std::uint32_t>(platforms.size());
+    header.platformOffset = sizeof(Header);
+    header.spawnCount = static_cast<std::uint32_t>(m_spawns.size());
+    header.spawnOffset = header.platformOffset + header.platformCount * sizeof(PlatformRecord);
+    header.chunkSize = m_chunkSize;
+    header.chunkColumns = chunkColumns;
+    header.chunkRows = chunkRows;
+    header.chunkOffset = header.spawnOffset + header.spawnCount * sizeof(SpawnRecord);
+    header.cellsPerChunk = cellsPerChunk;
+    header.gridCellOffset = header.chunkOffset + static_cast<std::uint32_t>(chunks.size() * sizeof(ChunkRecord));
+    header.indexCount = static_cast<std::uint32_t>(indices.size());
+    header.indexOffset = header.gridCellOffset + static_cast<std::uint32_t>(cells.size() * sizeof(GridCell));
+    
+    header.columnsPerChunk = columnsPerChunk;
+    header.columnOffset = header.indexOffset + static_cast<std::uint32_t>(indices.size() * sizeof(std::uint32_t));
+    header.surfaceCount = static_cast<std::uint32_t>(surfaces.size());
+    header.surfaceOffset = header.columnOffset + static_cast<std::uint32_t>(columns.size() * sizeof(SurfaceColumn));
+    
+    data.assign(header.surfaceOffset + surfaces.size() * sizeof(SurfaceRecord), 0);
+    std::memcpy(data.data(), &header, sizeof(Header));
+    if (!platforms.empty()) {
+        std::memcpy(data.data() + header.platformOffset, platforms.data(), platforms.size() * sizeof(PlatformRecord));
+    }
+    if (!m_spawns.empty()) {
+        std::memcpy(data.data() + header.spawnOffset, m_spawns.data(), m_spawns.size() * sizeof(SpawnRecord));
+    }
+    std::memcpy(data.data() + header.chunkOffset, chunks.data(), chunks.size() * sizeof(ChunkRecord));
+    std::memcpy(data.data() + header.gridCellOffset, cells.data(), cells.size() * sizeof(GridCell));
+    if (!indices.empty()) {
+        std::memcpy(data.data() + header.indexOffset, indices.data(), indices.size() * sizeof(std::uint32_t));
+    }
+    std::memcpy(data.data() + header.columnOffset, columns.data(), columns.size() * sizeof(SurfaceColumn));
+    if (!surfaces.empty()) {
+        std::memcpy(data.data() + header.surfaceOffset, surfaces.data(), surfaces.size() * sizeof(SurfaceRecord));
+    }
+    
+    return true;
+}
+
+std::uint32_t LevelBaker::defaultTerrainColor(std::uint32_t terrain) {
+    switch (terrain) {
+        case LevelFormat::TERRAIN_GRASS: return 0x228B22;  // Forest green
+        case LevelFormat::TERRAIN_ICE: return 0xADD8E6;    // Light blue
+        default: return 0x8B4513;                          // Brown
+    }
+}
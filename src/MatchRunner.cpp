@@ -0,0 +1,99 @@
+/**
+ * @file MatchRunner.cpp
+ * @brief Headless bot match runner implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "MatchRunner.h"
+#include <algorithm>
+#include <cmath>
+
+MatchRunner::MatchRunner() {
+}
+
+bool MatchRunner::loadLevel(const QString& path, QString* error) {
+    return m_engine.loadLevel(path, error);
+}
+
+MatchResult MatchRunner::run(const MatchSetup& setup, unsigned int seed, std::uint64_t match) {
+    m_engine.setPlayerCount(setup.players, setup.teams);
+    m_engine.setBalance(setup.balance);
+    m_engine.setSeed(seed, match);
+    for (int i = 0; i < setup.players; ++i) {
+        m_engine.setBot(i, createBot(setup.bots[i % setup.bots.size()], seed, match * setup.players + i));
+    }
+    m_engine.initialize();
+    m_engine.startGame();
+    
+    const double deltaTime = 1.0 / std::max(1, setup.tickRate);
+    MatchResult result{0, false, 0, -1, 0};
+    
+    m_previousPositions.clear();
+    for (const auto& player : m_engine.getPlayers()) {
+        m_previousPositions.push_back(player->getPosition());
+    }
+    
+    while (result.ticks < setup.maxTicks && m_engine.getGameState() == GameState::PLAYING) {
+        m_engine.update(deltaTime);
+        result.ticks++;
+        
+        if (result.firstKillTick < 0) {
+            for (const auto& player : m_engine.getPlayers()) {
+                if (!player->isAlive()) {
+                    result.firstKillTick = result.ticks;
+                    break;
+                }
+            }
+        }
+        if (setup.checkInvariants) {
+            if (!checkInvariants()) {
+                result.violations++;
+            }
+            for (std::size_t i = 0; i < m_previousPositions.size(); ++i) {
+                m_previousPositions[i] = m_engine.getPlayers()[i]->getPosition();
+            }
+        }
+    }
+    
+    result.timedOut = m_engine.getGameState() == GameState::PLAYING;
+    result.winner = result.timedOut ? 0 : m_engine.getWinner();
+    return result;
+}
+
+bool MatchRunner::checkInvariants() const {
+    double worldWidth = m_engine.getLevel().getWorldWidth();
+    double worldHeight = m_engine.getLevel().getWorldHeight();
+    
+    const Level& level = m_engine.getLevel();
+    const std::vector<std::shared_ptr<Player>>& players = m_engine.getPlayers();
+    
+    for (std::size_t i = 0; i < players.size(); ++i) {
+        const Player& player = *players[i];
+        if (!player.isAlive()) continue;
+        
+        Vector2D position = player.getPosition();
+        if (player.getHP() > player.getMaxHP()) return false;
+        if (!std::isfinite(position.x) || !std::isfinite(position.y)) return false;
+        if (position.x < 0 || position.x > worldWidth || position.y > worldHeight) return false;
+        
+        // Tunneling: the box overlapped a platform horizontally before and after the step, but
+        // was above it before and below it after (or the other way round)
+        Vector2D previous = m_previousPositions[i];
+        Vector2D size(player.getWidth(), player.getHeight());
+        Vector2D sweptMin(std::min(previous.x, position.x), std::min(previous.y, position.y));
+        Vector2D sweptMax(std::max(previous.x, position.x) + size.x, std::max(previous.y, position.y) + size.y);
+        bool tunneled = m_engine.getStreamer().queryPlatforms(sweptMin, sweptMax, [&](std::uint32_t index) {
+            const LevelFormat::PlatformRecord& platform = level.getPlatform(index);
+            auto overlapsX = [&](double x) { return x + size.x > platform.x && x < platform.x + platform.width; };
+            if (!overlapsX(previous.x) || !overlapsX(position.x)) return false;
+            
+            double top = platform.y;
+            double bottom = platform.y + platform.height;
+            return (previous.y + size.y <= top && position.y >= bottom) ||
+                   (previous.y >= bottom && position.y + size.y <= top);
+        });
+        if (tunneled) return false;
+    }
+    return true;
+}
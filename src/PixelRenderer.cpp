@@ -0,0 +1,213 @@
+/**
+ * @file PixelRenderer.cpp
+ * @brief Low-resolution integer rasterizer implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "PixelRenderer.h"
+#include "GameEngine.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    /**
+     * @brief Integer division rounding towards negative infinity
+     * @param a Dividend
+     * @param b Divisor (positive)
+     * @return long long Quotient
+     */
+    long long floorDiv(long long a, long long b) {
+        return a >= 0 ? a / b : -((-a + b - 1) / b);
+    }
+    
+    /**
+     * @brief Convert a color to the target format
+     * @param color Color (0xRRGGBB)
+     * @param channels Bytes per pixel
+     * @param out Receives the channel values
+     */
+    void convertColor(std::uint32_t color, int channels, std::uint8_t* out) {
+        int r = (color >> 16) & 0xFF;
+        int g = (color >> 8) & 0xFF;
+        int b = color & 0xFF;
+        
+        if (channels == 1) {
+            out[0] = static_cast<std::uint8_t>((77 * r + 150 * g + 29 * b) >> 8); // BT.601 luma
+        } else {
+            out[0] = static_cast<std::uint8_t>(r);
+            out[1] = static_cast<std::uint8_t>(g);
+            out[2] = static_cast<std::uint8_t>(b);
+        }
+    }
+}
+
+PixelRenderer::PixelRenderer(int width, int height, PixelFormat format)
+    : m_width(std::max(1, width)), m_height(std::max(1, height)),
+      m_channels(format == PixelFormat::GRAY8 ? 1 : 3) {
+    
+    // Same vertical sky gradient as GameWindow::drawBackground
+    m_background.resize(static_cast<std::size_t>(m_width) * m_height * m_channels);
+    for (int y = 0; y < m_height; ++y) {
+        int t = m_height > 1 ? y * 255 / (m_height - 1) : 0;
+        std::uint32_t color = static_cast<std::uint32_t>(135 + (176 - 135) * t / 255) << 16 |
+                              static_cast<std::uint32_t>(206 + (224 - 206) * t / 255) << 8 |
+                              static_cast<std::uint32_t>(235 + (230 - 235) * t / 255);
+        std::uint8_t converted[3];
+        convertColor(color, m_channels, converted);
+        
+        std::uint8_t* row = &m_background[static_cast<std::size_t>(y) * m_width * m_channels];
+        writeSpan(row, m_width, converted, 255);
+    }
+}
+
+Vector2D PixelRenderer::followPlayer(const GameEngine& engine, int playerIndex, const Vector2D& viewSize) {
+    std::shared_ptr<Player> player = engine.getPlayer(playerIndex);
+    if (!player) return Vector2D(0, 0);
+    
+    Vector2D center = player->getPosition() + Vector2D(player->getWidth(), player->getHeight()) * 0.5;
+    double maxX = std::max(0.0, engine.getLevel().getWorldWidth() - viewSize.x);
+    double maxY = std::max(0.0, engine.getLevel().getWorldHeight() - viewSize.y);
+    
+    return Vector2D(std::clamp<double>(center.x - viewSize.x / 2, 0.0, maxX),
+                    std::clamp<double>(center.y - viewSize.y / 2, 0.0, maxY));
+}
+
+void PixelRenderer::render(const GameEngine& engine, const Vector2D& viewOrigin, const Vector2D& viewSize,
+                           std::uint8_t* pixels) const {
+    ViewTransform view{
+        static_cast<int>(std::floor(viewOrigin.x)),
+        static_cast<int>(std::floor(viewOrigin.y)),
+        std::max(1, static_cast<int>(viewSize.x)),
+        std::max(1, static_cast<int>(viewSize.y))
+    };
+    
+    // Background
+    std::memcpy(pixels, m_background.data(), m_background.size());
+    
+    // Platforms of resident chunks; off-screen ones are rejected by fill()
+    const Level& level = engine.getLevel();
+    for (std::uint32_t index : engine.getStreamer().getActivePlatforms()) {
+        const LevelFormat::PlatformRecord& platform = level.getPlatform(index);
+        fill(pixels, view, static_cast<int>(platform.x), static_cast<int>(platform.y),
+             static_cast<int>(platform.width), static_cast<int>(platform.height), platform.color, 255, false);
+    }
+    
+    // Players and their weapons, laid out like GameWindow::drawPlayer
+    for (const auto& player : engine.getPlayers()) {
+        if (!player->isAlive()) continue;
+        
+        Vector2D pos = player->getPosition();
+        int x = static_cast<int>(pos.x);
+        int y = static_cast<int>(pos.y);
+        int w = static_cast<int>(player->getWidth());
+        int h = static_cast<int>(player->getHeight());
+        if (player->getState() == PlayerState::CROUCHING) {
+            y = static_cast<int>(pos.y + player->getHeight() * 0.4);
+            w = static_cast<int>(player->getWidth() * 1.2);
+            h = static_cast<int>(player->getHeight() * 0.6);
+        }
+        
+        fill(pixels, view, x, y, w, h, player->getColor(), player->isInvisible() ? 100 : 255, false);
+        
+        int weaponX = player->isFacingRight() ? static_cast<int>(pos.x + player->getWidth()) : static_cast<int>(pos.x - 15);
+        int weaponY = static_cast<int>(pos.y + player->getHeight() * 0.5);
+        std::uint32_t weaponColor = player->getWeapon().getSpec().color;
+        
+        switch (player->getWeapon().getType()) {
+            case WeaponType::FIST:
+                fill(pixels, view, weaponX - 5, weaponY - 5, 10, 10, weaponColor, 255, true);
+                break;
+            case WeaponType::KNIFE:
+                fill(pixels, view, weaponX - 2, weaponY - 8, 4, 16, weaponColor, 255, false);
+                break;
+            case WeaponType::BALL:
+                fill(pixels, view, weaponX - 6, weaponY - 6, 12, 12, weaponColor, 255, true);
+                break;
+            case WeaponType::RIFLE:
+                fill(pixels, view, weaponX - 15, weaponY - 3, 30, 6, weaponColor, 255, false);
+                break;
+            case WeaponType::SNIPER:
+                fill(pixels, view, weaponX - 20, weaponY - 4, 40, 8, weaponColor, 255, false);
+                break;
+        }
+    }
+    
+    // Projectiles and items
+    const EntityWorld& world = engine.getWorld();
+    for (std::size_t i = 0; i < world.sprites.size(); ++i) {
+        const Bounds& box = world.bounds.get(world.sprites.entityAt(i));
+        const Sprite& sprite = world.sprites.at(i);
+        fill(pixels, view, static_cast<int>(box.min.x), static_cast<int>(box.min.y),
+             static_cast<int>(box.max.x - box.min.x), static_cast<int>(box.max.y - box.min.y),
+             sprite.color, 255, sprite.shape == SpriteShape::ELLIPSE);
+    }
+}
+
+void PixelRenderer::fill(std::uint8_t* pixels, const ViewTransform& view, int x, int y, int w, int h,
+                         std::uint32_t color, int alpha, bool ellipse) const {
+    // Map the world rectangle to pixels, keeping at least one pixel
+    int px0 = static_cast<int>(floorDiv(static_cast<long long>(x - view.originX) * m_width, view.viewWidth));
+    int px1 = static_cast<int>(floorDiv(static_cast<long long>(x + w - view.originX) * m_width, view.viewWidth));
+    int py0 = static_cast<int>(floorDiv(static_cast<long long>(y - view.originY) * m_height, view.viewHeight));
+    int py1 = static_cast<int>(floorDiv(static_cast<long long>(y + h - view.originY) * m_height, view.viewHeight));
+    px1 = std::max(px1, px0 + 1);
+    py1 = std::max(py1, py0 + 1);
+    
+    if (px1 <= 0 || py1 <= 0 || px0 >= m_width || py0 >= m_height) return;
+    
+    std::uint8_t converted[3];
+    convertColor(color, m_channels, converted);
+    
+    int ellipseWidth = px1 - px0;
+    int ellipseHeight = py1 - py0;
+    int rowBegin = std::max(py0, 0);
+    int rowEnd = std::min(py1, m_height);
+    
+    for (int py = rowBegin; py < rowEnd; ++py) {
+        int spanBegin = px0;
+        int spanEnd = px1;
+        
+        if (ellipse) {
+            // Pixel centers inside the inscribed ellipse: |2dx + 1 - w| <= w * sqrt(1 - ((2dy + 1 - h) / h)^2)
+            long long dy = 2LL * (py - py0) + 1 - ellipseHeight;
+            long long radicand = static_cast<long long>(ellipseHeight) * ellipseHeight - dy * dy;
+            if (radicand < 0) continue;
+            
+            long long root = static_cast<long long>(std::sqrt(static_cast<double>(radicand)));
+            long long limit = ellipseWidth * root / ellipseHeight;
+            spanBegin = px0 + static_cast<int>((ellipseWidth - limit) / 2);
+            spanEnd = px0 + static_cast<int>((ellipseWidth + limit + 1) / 2);
+            if (spanEnd <= spanBegin) continue;
+        }
+        
+        spanBegin = std::max(spanBegin, 0);
+        spanEnd = std::min(spanEnd, m_width);
+        if (spanEnd <= spanBegin) continue;
+        
+        std::uint8_t* row = pixels + (static_cast<std::size_t>(py) * m_width + spanBegin) * m_channels;
+        writeSpan(row, spanEnd - spanBegin, converted, alpha);
+    }
+}
+
+void PixelRenderer::writeSpan(std::uint8_t* row, int count, const std::uint8_t* color, int alpha) const {
+    if (alpha >= 255) {
+        if (m_channels == 1) {
+            std::memset(row, color[0], count);
+        } else {
+            for (int i = 0; i < count; ++i, row += 3) {
+                row[0] = color[0];
+                row[1] = color[1];
+                row[2] = color[2];
+            }
+        }
+        return;
+    }
+    
+    // Blend over the existing pixels
+    for (int i = 0; i < count * m_channels; ++i) {
+        int channel = i % m_channels;
+        row[i] = static_cast<std::uint8_t>(row[i] + (((color[channel] - row[i]) * alpha) >> 8));
+    }
+}
@@ -6,38 +6,108 @@
  */
 
 #include "Player.h"
-#include "Weapon.h"
 #include "Item.h"
-#include <chrono>
+#include <cmath>
 #include <algorithm>
 
-Player::Player(const Vector2D& startPos, const QColor& playerColor, bool isPlayerOne) 
-    : m_position(startPos), m_velocity(0, 0), m_state(PlayerState::STANDING),
-      m_color(playerColor), m_isPlayerOne(isPlayerOne), m_facingRight(true),
+Player::Player(EntityWorld& world, TimerWheel& timers, const Vector2D& startPos, unsigned int playerColor, int index,
+               int team, const BalanceConfig& balance) 
+    : m_world(&world), m_timers(&timers), m_balance(&balance), m_state(PlayerState::STANDING),
+      m_color(playerColor), m_index(index), m_team(team), m_facingRight(true),
       m_hp(GameConfig::PLAYER_MAX_HP), m_isMovingLeft(false), m_isMovingRight(false),
-      m_isCrouching(false), m_isGrounded(false), m_currentTerrain(TerrainType::GROUND),
-      m_lastAttackTime(0), m_hasAdrenaline(false), m_adrenalineEndTime(0), m_lastAdrenalineHeal(0) {
+      m_isCrouching(false), m_currentTerrain(TerrainType::GROUND), m_supportPlatform(-1),
+      m_weapon(WeaponState::create(WeaponType::FIST, balance)), // Default fist weapon
+      m_attackGuard(NO_TIMER), m_adrenalineEnd(NO_TIMER), m_adrenalineHeal(NO_TIMER) {
     
-    // Default fist weapon
-    m_weapon = std::make_shared<FistWeapon>();
+    createEntity(startPos);
 }
 
 Player::~Player() {
 }
 
-void Player::update(double deltaTime) {
-    updatePhysics(deltaTime);
-    updateAdrenalineEffect(deltaTime);
+void Player::respawn(const Vector2D& startPos) {
+    m_state = PlayerState::STANDING;
+    m_facingRight = true;
+    m_hp = GameConfig::PLAYER_MAX_HP;
+    m_isMovingLeft = false;
+    m_isMovingRight = false;
+    m_isCrouching = false;
+    m_currentTerrain = TerrainType::GROUND;
+    m_supportPlatform = -1;
+    m_weapon = WeaponState::create(WeaponType::FIST, *m_balance);
+    m_attackGuard = NO_TIMER;
+    m_adrenalineEnd = NO_TIMER;
+    m_adrenalineHeal = NO_TIMER;
     
-    // Update weapon
-    if (m_weapon) {
-        m_weapon->update(deltaTime);
-    }
+    createEntity(startPos);
+}
+
+void Player::saveState(StateWriter& writer) const {
+    writer.write(m_entity);
+    writer.write(m_state);
+    writer.write(m_facingRight);
+    writer.write(m_hp);
+    writer.write(m_isMovingLeft);
+    writer.write(m_isMovingRight);
+    writer.write(m_isCrouching);
+    writer.write(m_currentTerrain);
+    writer.write(m_supportPlatform);
+    writer.write(m_weapon.type);
+    writer.write(m_weapon.ammo);
+    writer.write(m_weapon.cooldownTimer);
+    writer.write(m_attackGuard);
+    writer.write(m_adrenalineEnd);
+    writer.write(m_adrenalineHeal);
+}
+
+bool Player::restoreState(StateReader& reader) {
+    WeaponType weaponType = WeaponType::FIST;
+    int ammo = 0;
+    TimerHandle cooldownTimer = NO_TIMER;
+    
+    reader.read(m_entity);
+    reader.read(m_state);
+    reader.read(m_facingRight);
+    reader.read(m_hp);
+    reader.read(m_isMovingLeft);
+    reader.read(m_isMovingRight);
+    reader.read(m_isCrouching);
+    reader.read(m_currentTerrain);
+    reader.read(m_supportPlatform);
+    reader.read(weaponType);
+    reader.read(ammo);
+    reader.read(cooldownTimer);
+    reader.read(m_attackGuard);
+    reader.read(m_adrenalineEnd);
+    reader.read(m_adrenalineHeal);
+    
+    // The weapon points at the engine's balance parameters, so only its state is stored
+    if (static_cast<int>(weaponType) < 0 || static_cast<int>(weaponType) >= WEAPON_TYPE_COUNT) return false;
+    m_weapon = WeaponState::create(weaponType, *m_balance);
+    m_weapon.ammo = ammo;
+    m_weapon.cooldownTimer = cooldownTimer;
+    
+    return reader.isValid() && m_hp >= 0 && m_hp <= GameConfig::PLAYER_MAX_HP &&
+           m_world->motions.has(m_entity) && m_world->bodies.has(m_entity) &&
+           m_world->bounds.has(m_entity) && m_world->gravities.has(m_entity);
+}
+
+void Player::createEntity(const Vector2D& startPos) {
+    Vector2D size(GameConfig::PLAYER_WIDTH, GameConfig::PLAYER_HEIGHT);
+    m_entity = m_world->create();
+    m_world->motions.add(m_entity, Motion{startPos, Vector2D(0, 0)});
+    m_world->bodies.add(m_entity, Body{Vector2D(0, 0), size, 0.0});
+    m_world->bounds.add(m_entity, Bounds{startPos, startPos + size});
+    m_world->gravities.add(m_entity, Gravity{1.0, false});
+}
+
+void Player::update(double deltaTime) {
+    updateMovement();
     
     // Update state
     if (m_isCrouching) {
         m_state = PlayerState::CROUCHING;
-    } else if (!m_isGrounded) {
+    } else if (!isGrounded()) {
         m_state = PlayerState::JUMPING;
     } else if (m_isMovingLeft || m_isMovingRight) {
         m_state = PlayerState::MOVING;
@@ -46,6 +116,40 @@ void Player::update(double deltaTime) {
     }
 }
 
+void Player::onTimer(const TimerEvent& event) {
+    switch (event.kind) {
+        case TimerKind::WEAPON_READY:
+            if (m_weapon.cooldownTimer == event.handle) {
+                m_weapon.cooldownTimer = NO_TIMER;
+            }
+            break;
+        case TimerKind::ATTACK_READY:
+            if (m_attackGuard == event.handle) {
+                m_attackGuard = NO_TIMER;
+            }
+            break;
+        case TimerKind::ADRENALINE_HEAL:
+            if (m_adrenalineHeal != event.handle) break;
+            
+            // No heal once the effect ends, even when both fall due in the same millisecond
+            m_adrenalineHeal = NO_TIMER;
+            if (isAlive() && m_timers->getDeadline(m_adrenalineEnd) > m_timers->getTime()) {
+                heal(m_balance->adrenalineHeal);
+                m_adrenalineHeal = m_timers->schedule(1000, TimerKind::ADRENALINE_HEAL, m_index);
+            }
+            break;
+        case TimerKind::ADRENALINE_END:
+            if (m_adrenalineEnd == event.handle) {
+                m_adrenalineEnd = NO_TIMER;
+                m_timers->cancel(m_adrenalineHeal);
+                m_adrenalineHeal = NO_TIMER;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 void Player::moveLeft() {
     if (m_isCrouching) return; // Cannot move while crouching
     
@@ -67,17 +171,17 @@ void Player::stopMoving() {
 
 void Player::jump() {
     if (m_isCrouching) return; // Cannot jump while crouching
-    if (!m_isGrounded) return; // Can only jump when on ground
+    if (!isGrounded()) return; // Can only jump when on ground
     
-    m_velocity.y = GameConfig::PLAYER_JUMP_SPEED;
-    m_isGrounded = false;
+    m_world->motions.get(m_entity).velocity.y = GameConfig::PLAYER_JUMP_SPEED;
+    setGrounded(false);
 }
 
 void Player::crouch() {
-    if (!m_isGrounded) return; // Can only crouch when on ground
+    if (!isGrounded()) return; // Can only crouch when on ground
     
     m_isCrouching = true;
-    m_velocity.x = 0; // Stop horizontal movement when crouching
+    m_world->motions.get(m_entity).velocity.x = 0; // Stop horizontal movement when crouching
 }
 
 void Player::stopCrouching() {
@@ -85,23 +189,16 @@ void Player::stopCrouching() {
 }
 
 void Player::attack() {
-    if (!m_weapon) return;
-    
-    auto currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()).count();
+    if (m_attackGuard != NO_TIMER) return; // Prevent too frequent attacks
     
-    if (currentTime - m_lastAttackTime < 100) return; // Prevent too frequent attacks
-    
-    m_lastAttackTime = currentTime;
+    m_attackGuard = m_timers->schedule(100, TimerKind::ATTACK_READY, m_index);
     m_state = PlayerState::ATTACKING;
     
     // Weapon attack is handled in GameEngine
 }
 
-bool Player::pickupItem(std::shared_ptr<Item> item) {
-    if (!item || !item->isValid()) return false;
-    
-    return item->onPickup(this);
+bool Player::pickupItem(ItemType type) {
+    return applyItemPickup(type, this);
 }
 
 void Player::takeDamage(int damage) {
@@ -115,11 +212,11 @@ void Player::heal(int healAmount) {
 }
 
 void Player::applyAdrenaline(int duration) {
-    m_hasAdrenaline = true;
-    auto currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()).count();
-    m_adrenalineEndTime = currentTime + duration;
-    m_lastAdrenalineHeal = currentTime;
+    // A new dose restarts the effect
+    m_timers->cancel(m_adrenalineEnd);
+    m_timers->cancel(m_adrenalineHeal);
+    m_adrenalineEnd = m_timers->schedule(duration, TimerKind::ADRENALINE_END, m_index);
+    m_adrenalineHeal = m_timers->schedule(1000, TimerKind::ADRENALINE_HEAL, m_index);
 }
 
 void Player::setTerrainType(TerrainType terrain) {
@@ -127,7 +224,7 @@ void Player::setTerrainType(TerrainType terrain) {
 }
 
 bool Player::isGrounded() const {
-    return m_isGrounded;
+    return m_world->gravities.get(m_entity).grounded;
 }
 
 bool Player::isAlive() const {
@@ -139,71 +236,50 @@ bool Player::isInvisible() const {
     return m_currentTerrain == TerrainType::GRASS && m_isCrouching;
 }
 
-void Player::updatePhysics(double deltaTime) {
+void Player::updateMovement() {
+    Vector2D& velocity = m_world->motions.get(m_entity).velocity;
+    
     // Handle horizontal movement
     if (!m_isCrouching) {
         double moveSpeed = getCurrentMoveSpeed();
         
         if (m_isMovingLeft) {
-            m_velocity.x = -moveSpeed;
+            velocity.x = -moveSpeed;
         } else if (m_isMovingRight) {
-            m_velocity.x = moveSpeed;
+            velocity.x = moveSpeed;
         } else {
             // Apply friction
-            m_velocity.x *= GameConfig::FRICTION;
-            if (std::abs(m_velocity.x) < 10) {
-                m_velocity.x = 0;
+            velocity.x *= GameConfig::FRICTION;
+            if (std::abs(velocity.x) < 10) {
+                velocity.x = 0;
             }
         }
     }
-    
-    // Apply gravity
-    if (!m_isGrounded) {
-        m_velocity.y += GameConfig::GRAVITY * deltaTime;
-    }
-    
-    // Update position
-    m_position += m_velocity * deltaTime;
+}
+
+void Player::applyWorldBounds(double worldWidth) {
+    Motion& motion = m_world->motions.get(m_entity);
     
     // Boundary check
-    if (m_position.x < 0) {
-        m_position.x = 0;
-        m_velocity.x = 0;
+    if (motion.position.x < 0) {
+        motion.position.x = 0;
+        motion.velocity.x = 0;
     }
-    if (m_position.x > GameConfig::WINDOW_WIDTH - getWidth()) {
-        m_position.x = GameConfig::WINDOW_WIDTH - getWidth();
-        m_velocity.x = 0;
+    if (motion.position.x > worldWidth - getWidth()) {
+        motion.position.x = worldWidth - getWidth();
+        motion.velocity.x = 0;
     }
     
     // Ground check (simple implementation, actual collision detection in GameEngine)
-    if (m_position.y >= GameConfig::GROUND_LEVEL - getHeight()) {
-        m_position.y = GameConfig::GROUND_LEVEL - getHeight();
-        m_velocity.y = 0;
-        m_isGrounded = true;
+    if (motion.position.y >= GameConfig::GROUND_LEVEL - getHeight()) {
+        motion.position.y = GameConfig::GROUND_LEVEL - getHeight();
+        motion.velocity.y = 0;
+        setGrounded(true);
     }
-    // Note: don't set m_isGrounded = false here, as it would conflict with GameEngine's collision detection
+    // Note: don't set grounded = false here, as it would conflict with GameEngine's collision detection
     // GameEngine is responsible for setting the correct ground state
 }
 
-void Player::updateAdrenalineEffect(double deltaTime) {
-    if (!m_hasAdrenaline) return;
-    
-    auto currentTime = std::chrono::duration_cast<std::chrono::milliseconds>(
-        std::chrono::steady_clock::now().time_since_epoch()).count();
-    
-    // Check if adrenaline has expired
-    if (currentTime >= m_adrenalineEndTime) {
-        m_hasAdrenaline = false;
-        return;
-    }
-    
-    // Heal every second
-    if (currentTime - m_lastAdrenalineHeal >= 1000) {
-        heal(GameConfig::ADRENALINE_HEAL);
-        m_lastAdrenalineHeal = currentTime;
-    }
-}
-
 double Player::getCurrentMoveSpeed() const {
     double baseSpeed = GameConfig::PLAYER_SPEED;
     
@@ -213,8 +289,8 @@ double Player::getCurrentMoveSpeed() const {
     }
     
     // Adrenaline speed boost
-    if (m_hasAdrenaline) {
-        baseSpeed *= GameConfig::ADRENALINE_SPEED_MULTIPLIER;
+    if (m_adrenalineEnd != NO_TIMER) {
+        baseSpeed *= m_balance->adrenalineSpeedMultiplier;
     }
     
     return baseSpeed;
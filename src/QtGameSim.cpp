@@ -0,0 +1,274 @@
+/**
+ * @file QtGameSim.cpp
+ * @brief C API of the embeddable simulation library
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "QtGameSim.h"
+#include "GameEngine.h"
+#include <algorithm>
+#include <cstring>
+#include <exception>
+
+static_assert(QTGAME_ACTION_LEFT == Action::LEFT && QTGAME_ACTION_RIGHT == Action::RIGHT &&
+              QTGAME_ACTION_JUMP == Action::JUMP && QTGAME_ACTION_CROUCH == Action::CROUCH &&
+              QTGAME_ACTION_FIRE == Action::FIRE, "C action bits must match the engine");
+static_assert(QTGAME_STATE_PLAYING == static_cast<int>(GameState::PLAYING) &&
+              QTGAME_STATE_PAUSED == static_cast<int>(GameState::PAUSED) &&
+              QTGAME_STATE_GAME_OVER == static_cast<int>(GameState::GAME_OVER), "C states must match the engine");
+static_assert(QTGAME_BOT_AGGRESSIVE == static_cast<int>(BotType::AGGRESSIVE) &&
+              QTGAME_BOT_COLLECTOR == static_cast<int>(BotType::ITEM_COLLECTOR) &&
+              QTGAME_BOT_RANDOM == static_cast<int>(BotType::RANDOM), "C bot types must match the engine");
+
+/**
+ * @brief Match behind the opaque C handle
+ */
+struct qtgame_match {
+    GameEngine engine;                  ///< The simulation
+    std::vector<std::uint8_t> botDriven; ///< Whether a bot drives each player
+    std::int64_t tick = 0;              ///< Ticks since the last reset
+    unsigned int seed = 0;              ///< Current seed, also used for new random bots
+};
+
+namespace {
+    /**
+     * @brief Copy a message into a caller buffer
+     * @param error Target buffer (optional)
+     * @param size Buffer size
+     * @param message The message
+     */
+    void writeError(char* error, size_t size, const char* message) {
+        if (!error || size == 0) return;
+        
+        size_t length = std::min(std::strlen(message), size - 1);
+        std::memcpy(error, message, length);
+        error[length] = '\0';
+    }
+    
+    /**
+     * @brief Copy a message into a caller buffer
+     * @param error Target buffer (optional)
+     * @param size Buffer size
+     * @param message The message
+     */
+    void writeError(char* error, size_t size, const QString& message) {
+        writeError(error, size, message.toUtf8().constData());
+    }
+    
+    /**
+     * @brief Start a new round
+     * @param match The match
+     */
+    void startRound(qtgame_match* match) {
+        match->engine.initialize();
+        match->engine.startGame();
+        match->tick = 0;
+    }
+}
+
+uint32_t qtgame_abi_version(void) {
+    return QTGAME_SIM_ABI_VERSION;
+}
+
+qtgame_match* qtgame_create(const qtgame_config* config, char* error, size_t error_size) {
+    qtgame_config defaults = {2, 0, 0, nullptr, nullptr};
+    if (!config) config = &defaults;
+    
+    // Exceptions must not cross the C boundary: the engine starts threads and allocates while
+    // it is built, loads the level and grows the roster
+    qtgame_match* match = nullptr;
+    try {
+        match = new qtgame_match();
+        
+        if (config->balance) {
+            BalanceConfig balance;
+            QString message;
+            if (!balance.parse(QString::fromUtf8(config->balance), &message)) {
+                writeError(error, error_size, message);
+                delete match;
+                return nullptr;
+            }
+            match->engine.setBalance(balance);
+        }
+        
+        if (config->level_path) {
+            QString message;
+            if (!match->engine.loadLevel(QString::fromUtf8(config->level_path), &message)) {
+                writeError(error, error_size, message);
+                delete match;
+                return nullptr;
+            }
+        }
+        
+        match->engine.setPlayerCount(config->players, config->teams);
+        qtgame_seed(match, config->seed);
+        startRound(match);
+        match->botDriven.assign(match->engine.getPlayerCount(), 0);
+        return match;
+    } catch (const std::exception& exception) {
+        writeError(error, error_size, exception.what());
+    } catch (...) {
+        writeError(error, error_size, "Unknown error");
+    }
+    delete match;
+    return nullptr;
+}
+
+void qtgame_destroy(qtgame_match* match) {
+    delete match;
+}
+
+void qtgame_seed(qtgame_match* match, uint32_t seed) {
+    match->seed = seed;
+    match->engine.setSeed(seed);
+}
+
+int qtgame_reset(qtgame_match* match) {
+    try {
+        startRound(match);
+        return 0;
+    } catch (...) {
+        return -1;
+    }
+}
+
+int qtgame_set_bot(qtgame_match* match, int32_t player, int32_t bot) {
+    if (player < 0 || player >= match->engine.getPlayerCount()) return -1;
+    
+    if (bot == QTGAME_BOT_NONE) {
+        match->engine.setBot(player, nullptr);
+        match->engine.setPlayerActions(player, Action::NONE);
+        match->botDriven[player] = 0;
+        return 0;
+    }
+    if (bot < QTGAME_BOT_AGGRESSIVE || bot > QTGAME_BOT_RANDOM) return -1;
+    
+    try {
+        match->engine.setBot(player, createBot(static_cast<BotType>(bot), match->seed, player));
+    } catch (...) {
+        return -1;
+    }
+    match->botDriven[player] = 1;
+    return 0;
+}
+
+int32_t qtgame_step(qtgame_match* match, const uint8_t* actions, int32_t ticks) {
+    GameEngine& engine = match->engine;
+    const double deltaTime = 1.0 / GameConfig::TARGET_FPS;
+    const int players = engine.getPlayerCount();
+    
+    try {
+        for (int32_t tick = 0; tick < ticks && engine.getGameState() == GameState::PLAYING; ++tick) {
+            for (int player = 0; player < players; ++player) {
+                if (!match->botDriven[player]) {
+                    engine.setPlayerActions(player, actions[player]);
+                }
+            }
+            engine.update(deltaTime);
+            match->tick++;
+        }
+    } catch (...) {
+        return -1;
+    }
+    return static_cast<int32_t>(engine.getGameState());
+}
+
+void qtgame_read_match(const qtgame_match* match, qtgame_match_state* out) {
+    const GameEngine& engine = match->engine;
+    out->state = static_cast<int32_t>(engine.getGameState());
+    out->winner = engine.getWinner();
+    out->tick = match->tick;
+    out->players = engine.getPlayerCount();
+    out->projectiles = static_cast<int32_t>(engine.getWorld().projectiles.size());
+    out->items = static_cast<int32_t>(engine.getWorld().items.size());
+    out->reserved = 0;
+}
+
+int32_t qtgame_read_players(const qtgame_match* match, qtgame_player_state* out, int32_t capacity) {
+    const auto& players = match->engine.getPlayers();
+    int32_t count = static_cast<int32_t>(players.size());
+    
+    for (int32_t i = 0; i < std::min(count, capacity); ++i) {
+        const Player& player = *players[i];
+        qtgame_player_state& state = out[i];
+        Vector2D position = player.getPosition();
+        Vector2D velocity = player.getVelocity();
+        state.x = static_cast<float>(position.x);
+        state.y = static_cast<float>(position.y);
+        state.vx = static_cast<float>(velocity.x);
+        state.vy = static_cast<float>(velocity.y);
+        state.hp = player.getHP();
+        state.team = player.getTeam();
+        state.weapon = static_cast<int32_t>(player.getWeapon().getType());
+        state.ammo = player.getWeapon().getAmmo();
+        state.alive = player.isAlive() ? 1 : 0;
+        state.grounded = player.isGrounded() ? 1 : 0;
+        state.facing_right = player.isFacingRight() ? 1 : 0;
+        state.crouching = player.getState() == PlayerState::CROUCHING ? 1 : 0;
+        state.invisible = player.isInvisible() ? 1 : 0;
+        state.can_attack = player.getWeapon().canAttack() ? 1 : 0;
+        state.reserved[0] = 0;
+        state.reserved[1] = 0;
+    }
+    return count;
+}
+
+int32_t qtgame_read_projectiles(const qtgame_match* match, qtgame_projectile_state* out, int32_t capacity) {
+    const EntityWorld& world = match->engine.getWorld();
+    int32_t count = static_cast<int32_t>(world.projectiles.size());
+    
+    for (int32_t i = 0; i < std::min(count, capacity); ++i) {
+        const ProjectileInfo& info = world.projectiles.at(i);
+        const Motion& motion = world.motions.get(world.projectiles.entityAt(i));
+        qtgame_projectile_state& state = out[i];
+        state.x = static_cast<float>(motion.position.x);
+        state.y = static_cast<float>(motion.position.y);
+        state.vx = static_cast<float>(motion.velocity.x);
+        state.vy = static_cast<float>(motion.velocity.y);
+        state.damage = info.damage;
+        state.type = static_cast<int32_t>(info.type);
+        state.owner = info.ownerId;
+        state.team_mask = info.teamMask;
+    }
+    return count;
+}
+
+int32_t qtgame_read_items(const qtgame_match* match, qtgame_item_state* out, int32_t capacity) {
+    const EntityWorld& world = match->engine.getWorld();
+    int32_t count = static_cast<int32_t>(world.items.size());
+    
+    for (int32_t i = 0; i < std::min(count, capacity); ++i) {
+        const Motion& motion = world.motions.get(world.items.entityAt(i));
+        qtgame_item_state& state = out[i];
+        state.x = static_cast<float>(motion.position.x);
+        state.y = static_cast<float>(motion.position.y);
+        state.type = static_cast<int32_t>(world.items.at(i).type);
+        state.reserved = 0;
+    }
+    return count;
+}
+
+size_t qtgame_snapshot(const qtgame_match* match, void* buffer, size_t capacity) {
+    StateWriter writer(buffer, capacity);
+    writer.write(match->tick);
+    match->engine.saveState(writer);
+    return writer.getSize();
+}
+
+int qtgame_restore(qtgame_match* match, const void* buffer, size_t size) {
+    try {
+        StateReader reader(buffer, size);
+        std::int64_t tick = 0;
+        
+        if (reader.read(tick) && match->engine.restoreState(reader) && reader.atEnd()) {
+            match->tick = tick;
+            return 0;
+        }
+        
+        startRound(match);
+    } catch (...) {
+        // The match may be half restored; the caller resets or destroys it
+    }
+    return -1;
+}
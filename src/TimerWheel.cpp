@@ -0,0 +1,193 @@
+/**
+ * @file TimerWheel.cpp
+ * @brief Timer wheel class implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "TimerWheel.h"
+#include <algorithm>
+#include <cassert>
+
+TimerWheel::TimerWheel() : m_time(0), m_pending(0) {
+    m_heads.assign(LEVEL0_SLOTS + (LEVELS - 1) * LEVEL_SLOTS, -1);
+}
+
+void TimerWheel::clear() {
+    m_time = 0;
+    m_nodes.clear();
+    m_freeNodes.clear();
+    std::fill(m_heads.begin(), m_heads.end(), -1);
+    m_pending = 0;
+}
+
+void TimerWheel::reserve(std::size_t capacity) {
+    m_nodes.reserve(capacity);
+    m_freeNodes.reserve(capacity);
+}
+
+TimerHandle TimerWheel::schedule(std::int64_t delay, TimerKind kind, std::uint32_t target) {
+    std::int32_t index;
+    if (!m_freeNodes.empty()) {
+        index = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    } else {
+        index = static_cast<std::int32_t>(m_nodes.size());
+        assert(index < (1 << INDEX_BITS));
+        m_nodes.push_back(Node{0, 0, kind, 0, -1, -1, -1});
+    }
+    
+    Node& node = m_nodes[index];
+    node.deadline = m_time + std::max<std::int64_t>(delay, 1);
+    node.target = target;
+    node.kind = kind;
+    node.generation = static_cast<std::uint16_t>(node.generation % (GENERATIONS - 1) + 1);
+    insert(index);
+    m_pending++;
+    return handleOf(index);
+}
+
+bool TimerWheel::cancel(TimerHandle handle) {
+    std::int32_t index = findNode(handle);
+    if (index < 0) return false;
+    
+    unlink(index);
+    release(index);
+    return true;
+}
+
+std::int64_t TimerWheel::getDeadline(TimerHandle handle) const {
+    std::int32_t index = findNode(handle);
+    return index >= 0 ? m_nodes[index].deadline : -1;
+}
+
+void TimerWheel::saveState(StateWriter& writer) const {
+    writer.write(m_time);
+    writer.write(static_cast<std::uint64_t>(m_pending));
+    writer.writeVector(m_nodes);
+    writer.writeVector(m_freeNodes);
+    writer.writeVector(m_heads);
+}
+
+bool TimerWheel::restoreState(StateReader& reader) {
+    std::uint64_t pending = 0;
+    if (!reader.read(m_time) || !reader.read(pending) || !reader.readVector(m_nodes) ||
+        !reader.readVector(m_freeNodes) || !reader.readVector(m_heads)) {
+        return false;
+    }
+    m_pending = static_cast<std::size_t>(pending);
+    if (m_heads.size() != static_cast<std::size_t>(LEVEL0_SLOTS + (LEVELS - 1) * LEVEL_SLOTS) ||
+        m_nodes.size() > (std::size_t{1} << INDEX_BITS) || m_pending + m_freeNodes.size() != m_nodes.size()) {
+        return false;
+    }
+    
+    // Every pending node must sit in the list of its slot with matching links; walking more
+    // nodes than are pending means a cycle
+    const std::int32_t nodeCount = static_cast<std::int32_t>(m_nodes.size());
+    std::size_t linked = 0;
+    for (std::int32_t slot = 0; slot < static_cast<std::int32_t>(m_heads.size()); ++slot) {
+        std::int32_t previous = -1;
+        for (std::int32_t index = m_heads[slot]; index != -1; index = m_nodes[index].next) {
+            if (index < 0 || index >= nodeCount || ++linked > m_pending) return false;
+            if (m_nodes[index].slot != slot || m_nodes[index].prev != previous) return false;
+            previous = index;
+        }
+    }
+    if (linked != m_pending) return false;
+    
+    // Every free node must be listed once for reuse; listed nodes are marked in place, so
+    // restoring does not allocate
+    bool listed = true;
+    for (std::int32_t index : m_freeNodes) {
+        if (index < 0 || index >= nodeCount || m_nodes[index].slot != -1) {
+            listed = false;
+            break;
+        }
+        m_nodes[index].slot = -2;
+    }
+    for (Node& node : m_nodes) {
+        if (node.slot == -2) node.slot = -1;
+    }
+    return listed;
+}
+
+std::int32_t TimerWheel::slotFor(std::int64_t deadline) const {
+    std::int64_t delta = deadline - m_time;
+    if (delta < LEVEL0_SLOTS) {
+        return static_cast<std::int32_t>(deadline & (LEVEL0_SLOTS - 1));
+    }
+    
+    // A level holds deadlines less than one full turn of its slots ahead; the top level holds
+    // later ones at its furthest slot until they come into range
+    for (int level = 1; level < LEVELS; ++level) {
+        int shift = levelShift(level);
+        std::int64_t span = std::int64_t{1} << (shift + LEVEL_BITS);
+        if (delta < span || level == LEVELS - 1) {
+            std::int64_t slotTime = std::min(deadline, m_time + span - 1);
+            return LEVEL0_SLOTS + (level - 1) * LEVEL_SLOTS +
+                   static_cast<std::int32_t>((slotTime >> shift) & (LEVEL_SLOTS - 1));
+        }
+    }
+    return -1;
+}
+
+void TimerWheel::cascadeDue() {
+    if ((m_time & (LEVEL0_SLOTS - 1)) != 0) return;
+    
+    // Higher levels first, so their timers can continue down into a lower slot due now
+    for (int level = LEVELS - 1; level >= 1; --level) {
+        int shift = levelShift(level);
+        if ((m_time & ((std::int64_t{1} << shift) - 1)) != 0) continue;
+        
+        std::int32_t slot = LEVEL0_SLOTS + (level - 1) * LEVEL_SLOTS +
+                            static_cast<std::int32_t>((m_time >> shift) & (LEVEL_SLOTS - 1));
+        std::int32_t index = m_heads[slot];
+        m_heads[slot] = -1;
+        while (index >= 0) {
+            std::int32_t next = m_nodes[index].next;
+            insert(index);
+            index = next;
+        }
+    }
+}
+
+void TimerWheel::insert(std::int32_t index) {
+    Node& node = m_nodes[index];
+    std::int32_t slot = slotFor(node.deadline);
+    std::int32_t head = m_heads[slot];
+    
+    node.slot = slot;
+    node.prev = -1;
+    node.next = head;
+    if (head >= 0) {
+        m_nodes[head].prev = index;
+    }
+    m_heads[slot] = index;
+}
+
+void TimerWheel::unlink(std::int32_t index) {
+    Node& node = m_nodes[index];
+    if (node.prev >= 0) {
+        m_nodes[node.prev].next = node.next;
+    } else {
+        m_heads[node.slot] = node.next;
+    }
+    if (node.next >= 0) {
+        m_nodes[node.next].prev = node.prev;
+    }
+}
+
+void TimerWheel::release(std::int32_t index) {
+    m_nodes[index].slot = -1;
+    m_freeNodes.push_back(index);
+    m_pending--;
+}
+
+std::int32_t TimerWheel::findNode(TimerHandle handle) const {
+    std::int32_t index = static_cast<std::int32_t>(handle & ((1u << INDEX_BITS) - 1));
+    std::uint32_t generation = handle >> INDEX_BITS;
+    
+    if (handle == NO_TIMER || index >= static_cast<std::int32_t>(m_nodes.size())) return -1;
+    const Node& node = m_nodes[index];
+    return node.slot >= 0 && node.generation == generation ? index : -1;
+}
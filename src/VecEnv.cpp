@@ -0,0 +1,315 @@
+/**
+ * @file VecEnv.cpp
+ * @brief Vectorized training environment implementation
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "VecEnv.h"
+#include <algorithm>
+#include <array>
+
+VecEnv::VecEnv(const VecEnvConfig& config)
+    : m_config(config), m_observationSize(0), m_threadCount(1), m_generation(0), m_pending(0), m_stopping(false),
+      m_actions(nullptr) {
+    m_config.envCount = std::max(1, m_config.envCount);
+    m_config.players = std::max(2, m_config.players);
+    m_config.agents = std::clamp(m_config.agents, 1, m_config.players);
+    m_config.frameSkip = std::max(1, m_config.frameSkip);
+    m_config.maxEpisodeTicks = std::max(1, m_config.maxEpisodeTicks);
+    
+    m_observationSize = SELF_FEATURES + (m_config.players - 1) * PLAYER_FEATURES +
+                        MAX_PROJECTILES * PROJECTILE_FEATURES + MAX_ITEMS * ITEM_FEATURES;
+    
+    // All buffers are sized once; step() never allocates them again
+    int rows = m_config.envCount * m_config.agents;
+    m_observations.assign(static_cast<std::size_t>(rows) * m_observationSize, 0.0f);
+    m_rewards.assign(rows, 0.0f);
+    m_dones.assign(m_config.envCount, 0);
+    m_episodeTicks.assign(m_config.envCount, 0);
+    m_previousHP.assign(static_cast<std::size_t>(m_config.envCount) * m_config.players, 0);
+    if (m_config.pixelWidth > 0 && m_config.pixelHeight > 0) {
+        m_renderer = std::make_unique<const PixelRenderer>(m_config.pixelWidth, m_config.pixelHeight,
+                                                           m_config.pixelFormat);
+        m_pixels.assign(static_cast<std::size_t>(rows) * m_renderer->getFrameSize(), 0);
+    }
+    
+    for (int env = 0; env < m_config.envCount; ++env) {
+        auto engine = std::make_unique<GameEngine>();
+        engine->setPlayerCount(m_config.players, m_config.teams);
+        engine->setBalance(m_config.balance);
+        engine->setSeed(m_config.seed, env);
+        for (int player = m_config.agents; player < m_config.players; ++player) {
+            engine->setBot(player, createBot(m_config.opponent, m_config.seed, env * m_config.players + player));
+        }
+        m_engines.push_back(std::move(engine));
+    }
+    
+    m_threadCount = m_config.threads > 0 ? m_config.threads
+                                         : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    m_threadCount = std::min(m_threadCount, m_config.envCount);
+    for (int thread = 1; thread < m_threadCount; ++thread) {
+        m_threads.emplace_back(&VecEnv::workerLoop, this, thread);
+    }
+    
+    reset();
+}
+
+VecEnv::~VecEnv() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+bool VecEnv::loadLevel(const QString& path, QString* error) {
+    for (const auto& engine : m_engines) {
+        if (!engine->loadLevel(path, error)) return false;
+    }
+    reset();
+    return true;
+}
+
+void VecEnv::reset() {
+    for (int env = 0; env < m_config.envCount; ++env) {
+        resetEnv(env);
+        writeObservations(env);
+        renderPixels(env);
+    }
+    std::fill(m_rewards.begin(), m_rewards.end(), 0.0f);
+    std::fill(m_dones.begin(), m_dones.end(), 0);
+}
+
+void VecEnv::step(const ActionMask* actions) {
+    // Hand the helper threads their ranges, then do range 0 on the calling thread
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_actions = actions;
+        m_pending = static_cast<int>(m_threads.size());
+        m_generation++;
+    }
+    m_wake.notify_all();
+    
+    stepRange(0);
+    
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this]() { return m_pending == 0; });
+}
+
+void VecEnv::workerLoop(int thread) {
+    long long seen = 0;
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&]() { return m_stopping || m_generation != seen; });
+            if (m_stopping) return;
+            seen = m_generation;
+        }
+        
+        stepRange(thread);
+        
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            last = --m_pending == 0;
+        }
+        if (last) {
+            m_finished.notify_one();
+        }
+    }
+}
+
+void VecEnv::stepRange(int thread) {
+    // Contiguous, equally sized environment ranges per thread
+    int begin = static_cast<int>(static_cast<long long>(m_config.envCount) * thread / m_threadCount);
+    int end = static_cast<int>(static_cast<long long>(m_config.envCount) * (thread + 1) / m_threadCount);
+    const double deltaTime = 1.0 / GameConfig::TARGET_FPS;
+    const int players = m_config.players;
+    const int agents = m_config.agents;
+    
+    for (int env = begin; env < end; ++env) {
+        GameEngine& engine = *m_engines[env];
+        const ActionMask* envActions = m_actions + static_cast<std::size_t>(env) * agents;
+        
+        for (int frame = 0; frame < m_config.frameSkip && engine.getGameState() == GameState::PLAYING; ++frame) {
+            for (int agent = 0; agent < agents; ++agent) {
+                engine.setPlayerActions(agent, envActions[agent]);
+            }
+            engine.update(deltaTime);
+            m_episodeTicks[env]++;
+        }
+        
+        // Team hp loss since the previous step
+        int* previousHP = &m_previousHP[static_cast<std::size_t>(env) * players];
+        std::array<int, GameConfig::MAX_TEAMS> teamLoss{};
+        int totalLoss = 0;
+        for (int player = 0; player < players; ++player) {
+            const Player& current = *engine.getPlayers()[player];
+            int loss = previousHP[player] - current.getHP();
+            teamLoss[current.getTeam()] += loss;
+            totalLoss += loss;
+            previousHP[player] = current.getHP();
+        }
+        
+        bool roundOver = engine.getGameState() == GameState::GAME_OVER;
+        for (int agent = 0; agent < agents; ++agent) {
+            int team = engine.getPlayers()[agent]->getTeam();
+            float reward = static_cast<float>(totalLoss - 2 * teamLoss[team]) / GameConfig::PLAYER_MAX_HP;
+            if (roundOver && engine.getWinner() != 0) {
+                reward += engine.getWinner() == team + 1 ? 1.0f : -1.0f;
+            }
+            m_rewards[static_cast<std::size_t>(env) * agents + agent] = reward;
+        }
+        
+        // Auto-reset: the returned observation starts the next episode
+        bool done = roundOver || m_episodeTicks[env] >= m_config.maxEpisodeTicks;
+        m_dones[env] = done ? 1 : 0;
+        if (done) {
+            resetEnv(env);
+        }
+        writeObservations(env);
+        renderPixels(env);
+    }
+}
+
+void VecEnv::resetEnv(int env) {
+    GameEngine& engine = *m_engines[env];
+    engine.initialize();
+    engine.startGame();
+    m_episodeTicks[env] = 0;
+    
+    int* previousHP = &m_previousHP[static_cast<std::size_t>(env) * m_config.players];
+    for (int player = 0; player < m_config.players; ++player) {
+        previousHP[player] = engine.getPlayers()[player]->getHP();
+    }
+}
+
+void VecEnv::renderPixels(int env) {
+    if (!m_renderer) return;
+    
+    const GameEngine& engine = *m_engines[env];
+    std::size_t frameSize = m_renderer->getFrameSize();
+    for (int agent = 0; agent < m_config.agents; ++agent) {
+        std::uint8_t* frame = &m_pixels[(static_cast<std::size_t>(env) * m_config.agents + agent) * frameSize];
+        Vector2D origin = PixelRenderer::followPlayer(engine, agent, m_config.pixelView);
+        m_renderer->render(engine, origin, m_config.pixelView, frame);
+    }
+}
+
+void VecEnv::writeObservations(int env) {
+    const GameEngine& engine = *m_engines[env];
+    const EntityWorld& world = engine.getWorld();
+    const auto& players = engine.getPlayers();
+    const double worldWidth = engine.getLevel().getWorldWidth();
+    const double worldHeight = engine.getLevel().getWorldHeight();
+    const double maxHP = GameConfig::PLAYER_MAX_HP;
+    const double speedScale = 1.0 / GameConfig::BULLET_SPEED;
+    
+    for (int agent = 0; agent < m_config.agents; ++agent) {
+        const Player& self = *players[agent];
+        Vector2D position = self.getPosition();
+        Vector2D velocity = self.getVelocity();
+        const WeaponState& weapon = self.getWeapon();
+        float* row = &m_observations[(static_cast<std::size_t>(env) * m_config.agents + agent) * m_observationSize];
+        
+        // Self
+        *row++ = static_cast<float>(position.x / worldWidth);
+        *row++ = static_cast<float>(position.y / worldHeight);
+        *row++ = static_cast<float>(velocity.x / GameConfig::PLAYER_SPEED);
+        *row++ = static_cast<float>(velocity.y / -GameConfig::PLAYER_JUMP_SPEED);
+        *row++ = static_cast<float>(self.getHP() / maxHP);
+        *row++ = self.isGrounded() ? 1.0f : 0.0f;
+        *row++ = self.isFacingRight() ? 1.0f : -1.0f;
+        *row++ = weapon.canAttack() ? 1.0f : 0.0f;
+        *row++ = weapon.getAmmo() < 0 ? 1.0f : static_cast<float>(weapon.getAmmo()) / std::max(1, weapon.getSpec().ammo);
+        for (int type = 0; type < WEAPON_TYPE_COUNT; ++type) {
+            *row++ = static_cast<int>(weapon.getType()) == type ? 1.0f : 0.0f;
+        }
+        
+        // Other players in index order
+        for (int other = 0; other < m_config.players; ++other) {
+            if (other == agent) continue;
+            
+            const Player& player = *players[other];
+            Vector2D offset = player.getPosition() - position;
+            bool visible = player.isAlive() && !player.isInvisible();
+            *row++ = visible ? static_cast<float>(offset.x / worldWidth) : 0.0f;
+            *row++ = visible ? static_cast<float>(offset.y / worldHeight) : 0.0f;
+            *row++ = visible ? static_cast<float>(player.getVelocity().x / GameConfig::PLAYER_SPEED) : 0.0f;
+            *row++ = visible ? static_cast<float>(player.getVelocity().y / -GameConfig::PLAYER_JUMP_SPEED) : 0.0f;
+            *row++ = static_cast<float>(player.getHP() / maxHP);
+            *row++ = player.isAlive() ? 1.0f : 0.0f;
+            *row++ = player.getTeam() == self.getTeam() ? 1.0f : 0.0f;
+            *row++ = visible ? 1.0f : 0.0f;
+        }
+        
+        // Nearest projectiles, kept sorted in a fixed-size array
+        std::array<Nearest, MAX_PROJECTILES> projectiles;
+        int projectileCount = 0;
+        for (std::size_t i = 0; i < world.projectiles.size(); ++i) {
+            double distance = world.motions.get(world.projectiles.entityAt(i)).position.distanceTo(position);
+            if (projectileCount == MAX_PROJECTILES && distance >= projectiles[MAX_PROJECTILES - 1].distance) continue;
+            
+            int slot = std::min(projectileCount, MAX_PROJECTILES - 1);
+            while (slot > 0 && projectiles[slot - 1].distance > distance) {
+                projectiles[slot] = projectiles[slot - 1];
+                slot--;
+            }
+            projectiles[slot] = Nearest{distance, i};
+            projectileCount = std::min(projectileCount + 1, MAX_PROJECTILES);
+        }
+        for (int slot = 0; slot < MAX_PROJECTILES; ++slot) {
+            if (slot >= projectileCount) {
+                std::fill(row, row + PROJECTILE_FEATURES, 0.0f);
+                row += PROJECTILE_FEATURES;
+                continue;
+            }
+            std::size_t index = projectiles[slot].index;
+            const Motion& motion = world.motions.get(world.projectiles.entityAt(index));
+            Vector2D offset = motion.position - position;
+            *row++ = static_cast<float>(offset.x / worldWidth);
+            *row++ = static_cast<float>(offset.y / worldHeight);
+            *row++ = static_cast<float>(motion.velocity.x * speedScale);
+            *row++ = static_cast<float>(motion.velocity.y * speedScale);
+            *row++ = (world.projectiles.at(index).teamMask & self.getTeamMask()) ? 0.0f : 1.0f;
+            *row++ = 1.0f;
+        }
+        
+        // Nearest items
+        std::array<Nearest, MAX_ITEMS> items;
+        int itemCount = 0;
+        for (std::size_t i = 0; i < world.items.size(); ++i) {
+            double distance = world.motions.get(world.items.entityAt(i)).position.distanceTo(position);
+            if (itemCount == MAX_ITEMS && distance >= items[MAX_ITEMS - 1].distance) continue;
+            
+            int slot = std::min(itemCount, MAX_ITEMS - 1);
+            while (slot > 0 && items[slot - 1].distance > distance) {
+                items[slot] = items[slot - 1];
+                slot--;
+            }
+            items[slot] = Nearest{distance, i};
+            itemCount = std::min(itemCount + 1, MAX_ITEMS);
+        }
+        for (int slot = 0; slot < MAX_ITEMS; ++slot) {
+            if (slot >= itemCount) {
+                std::fill(row, row + ITEM_FEATURES, 0.0f);
+                row += ITEM_FEATURES;
+                continue;
+            }
+            std::size_t index = items[slot].index;
+            Vector2D offset = world.motions.get(world.items.entityAt(index)).position - position;
+            int itemType = static_cast<int>(world.items.at(index).type);
+            *row++ = static_cast<float>(offset.x / worldWidth);
+            *row++ = static_cast<float>(offset.y / worldHeight);
+            *row++ = 1.0f;
+            for (int type = 0; type < ITEM_TYPE_COUNT; ++type) {
+                *row++ = itemType == type ? 1.0f : 0.0f;
+            }
+        }
+    }
+}
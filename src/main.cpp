@@ -6,8 +6,11 @@
  */
 
 #include "GameWindow.h"
+#include "InputInjector.h"
 #include <QApplication>
+#include <QCommandLineParser>
 #include <QFont>
+#include <QDebug>
 
 int main(int argc, char *argv[]) {
     QApplication app(argc, argv);
@@ -17,13 +20,56 @@ int main(int argc, char *argv[]) {
     app.setApplicationVersion("1.0");
     app.setOrganizationName("QtGame Team");
     
+    // Command line options for latency measurement runs
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption injectOption("inject-input", "Inject <count> synthetic key presses, then exit.", "count");
+    QCommandLineOption intervalOption("inject-interval", "Base interval between injected presses.", "ms", "50");
+    QCommandLineOption reportOption("latency-report", "Write latency statistics CSV to <file> on exit.", "file",
+                                    "latency_stats.csv");
+    QCommandLineOption levelOption("level", "Play on the baked level <file> instead of the built-in arena.", "file");
+    QCommandLineOption botOption("bot", "Let a bot (aggressive, collector or random) play player 2.", "type");
+    parser.addOption(levelOption);
+    parser.addOption(botOption);
+    parser.addOption(injectOption);
+    parser.addOption(intervalOption);
+    parser.addOption(reportOption);
+    parser.process(app);
+    
     // Set default font
     QFont font("Arial", 10);
     app.setFont(font);
     
     // Create and display main window
     GameWindow window;
+    if (parser.isSet(levelOption)) {
+        QString error;
+        if (!window.loadLevel(parser.value(levelOption), &error)) {
+            qWarning().noquote() << "Failed to load level:" << error;
+            return 1;
+        }
+    }
+    if (parser.isSet(botOption)) {
+        BotType type;
+        if (!parseBotType(parser.value(botOption), type)) {
+            qWarning().noquote() << "Unknown bot type:" << parser.value(botOption);
+            return 1;
+        }
+        window.setBot(1, type);
+    }
     window.show();
     
+    // Headless latency run, e.g. with -platform offscreen
+    if (parser.isSet(injectOption)) {
+        auto* injector = new InputInjector(&window, parser.value(injectOption).toInt(),
+                                           parser.value(intervalOption).toInt(), &app);
+        QString reportPath = parser.value(reportOption);
+        QObject::connect(injector, &InputInjector::finished, &app, [&window, reportPath]() {
+            window.exportLatencyStatistics(reportPath);
+            QApplication::quit();
+        });
+        injector->start();
+    }
+    
     return app.exec();
-} 
\ No newline at end of file
+}
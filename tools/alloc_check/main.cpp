@@ -0,0 +1,164 @@
+/**
+ * @file main.cpp
+ * @brief Steady-state allocation check
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "AllocationTracker.h"
+#include "GameEngine.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QStringList>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Check parameters
+ */
+struct CheckConfig {
+    int players;                  ///< Players per match
+    int teams;                    ///< Teams per match (0: one per player)
+    std::vector<BotType> bots;    ///< Bot types, assigned round-robin
+    int threads;                  ///< Threads per engine update
+    int warmupTicks;              ///< Ticks before measuring
+    int ticks;                    ///< Measured ticks
+    unsigned int seed;            ///< Random seed
+};
+
+/**
+ * @brief Start a bot match on the engine
+ * @param engine The engine
+ * @param config Check parameters
+ * @param match Match index, selects the random streams
+ */
+void startMatch(GameEngine& engine, const CheckConfig& config, std::uint64_t match) {
+    engine.setSeed(config.seed, match);
+    for (int i = 0; i < config.players; ++i) {
+        engine.setBot(i, createBot(config.bots[i % config.bots.size()], config.seed, match * config.players + i));
+    }
+    engine.initialize();
+    engine.startGame();
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption playersOption("players", "Players per match.", "count", "16");
+    QCommandLineOption teamsOption("teams", "Teams per match (0: one per player).", "count", "0");
+    QCommandLineOption botsOption("bots", "Comma separated bot types (aggressive, collector, random), "
+                                  "assigned to players round-robin.", "types", "aggressive,collector,random");
+    QCommandLineOption threadsOption("threads", "Threads per engine update (0: one per core).", "count", "1");
+    QCommandLineOption warmupOption("warmup", "Ticks before measuring.", "count", "600");
+    QCommandLineOption ticksOption("ticks", "Measured ticks.", "count", "7200");
+    QCommandLineOption levelOption("level", "Baked level file to run on.", "file");
+    QCommandLineOption seedOption("seed", "Random seed.", "seed", "1");
+    QCommandLineOption traceOption("trace", "Write per-tick allocation counts of the last ticks as CSV.", "file");
+    parser.addOption(playersOption);
+    parser.addOption(teamsOption);
+    parser.addOption(botsOption);
+    parser.addOption(threadsOption);
+    parser.addOption(warmupOption);
+    parser.addOption(ticksOption);
+    parser.addOption(levelOption);
+    parser.addOption(seedOption);
+    parser.addOption(traceOption);
+    parser.process(app);
+    
+    if (!AllocationTracker::isEnabled()) {
+        std::fprintf(stderr, "Allocation tracking is off; configure with -DQTGAME_ALLOC_TRACKING=ON\n");
+        return 2;
+    }
+    
+    CheckConfig config;
+    config.players = std::max(2, parser.value(playersOption).toInt());
+    config.teams = std::max(0, parser.value(teamsOption).toInt());
+    config.threads = std::max(0, parser.value(threadsOption).toInt());
+    config.warmupTicks = std::max(0, parser.value(warmupOption).toInt());
+    config.ticks = std::max(1, parser.value(ticksOption).toInt());
+    config.seed = parser.value(seedOption).toUInt();
+    for (const QString& name : parser.value(botsOption).split(',', Qt::SkipEmptyParts)) {
+        BotType type;
+        if (!parseBotType(name.trimmed(), type)) {
+            std::fprintf(stderr, "Unknown bot type: %s\n", qPrintable(name));
+            return 1;
+        }
+        config.bots.push_back(type);
+    }
+    if (config.bots.empty()) {
+        std::fprintf(stderr, "No bot types given\n");
+        return 1;
+    }
+    
+    GameEngine engine;
+    QString error;
+    if (parser.isSet(levelOption) && !engine.loadLevel(parser.value(levelOption), &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return 1;
+    }
+    engine.setPlayerCount(config.players, config.teams);
+    engine.setThreadCount(config.threads);
+    
+    std::uint64_t match = 0;
+    startMatch(engine, config, match);
+    
+    const double deltaTime = 1.0 / GameConfig::TARGET_FPS;
+    AllocationSnapshot measured{};
+    AllocationTrace trace;
+    int allocatingTicks = 0;
+    int firstAllocatingTick = -1;
+    
+    for (int tick = 0; tick < config.warmupTicks + config.ticks; ++tick) {
+        // A new round reuses the capacity of the previous one, so it does not restart the warmup
+        if (engine.getGameState() == GameState::GAME_OVER) {
+            startMatch(engine, config, ++match);
+        }
+        
+        AllocationSnapshot before = AllocationTracker::snapshot();
+        engine.update(deltaTime);
+        AllocationSnapshot counts = AllocationTracker::difference(before, AllocationTracker::snapshot());
+        trace.recordFrame();
+        if (tick < config.warmupTicks) continue;
+        
+        AllocationCounts total = AllocationTracker::sum(counts, AllocationPhase::OTHER, AllocationPhase::RENDER_HUD);
+        if (total.allocations > 0) {
+            allocatingTicks++;
+            if (firstAllocatingTick < 0) firstAllocatingTick = tick;
+        }
+        for (std::size_t i = 0; i < counts.size(); ++i) {
+            measured[i].allocations += counts[i].allocations;
+            measured[i].bytes += counts[i].bytes;
+            measured[i].deallocations += counts[i].deallocations;
+        }
+    }
+    
+    if (parser.isSet(traceOption) && !trace.exportTrace(parser.value(traceOption))) {
+        std::fprintf(stderr, "Cannot write %s\n", qPrintable(parser.value(traceOption)));
+    }
+    
+    std::printf("players:        %d (%d threads, %llu matches)\n", config.players, engine.getThreadCount(),
+                static_cast<unsigned long long>(match + 1));
+    std::printf("measured ticks: %d after %d warmup ticks\n", config.ticks, config.warmupTicks);
+    for (std::size_t i = 0; i < measured.size(); ++i) {
+        if (measured[i].allocations == 0 && measured[i].deallocations == 0) continue;
+        std::printf("%-22s %8llu allocs %10llu bytes %8llu frees\n",
+                    AllocationTracker::getPhaseName(static_cast<AllocationPhase>(i)),
+                    static_cast<unsigned long long>(measured[i].allocations),
+                    static_cast<unsigned long long>(measured[i].bytes),
+                    static_cast<unsigned long long>(measured[i].deallocations));
+    }
+    std::printf("allocating ticks: %d", allocatingTicks);
+    if (firstAllocatingTick >= 0) {
+        std::printf(" (first at tick %d)", firstAllocatingTick);
+    }
+    std::printf("\n");
+    
+    return allocatingTicks == 0 ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+/**
+ * @file main.cpp
+ * @brief Monte Carlo balance sweep over BalanceConfig parameters
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "MatchRunner.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QStringList>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief One swept parameter
+ */
+struct SweepAxis {
+    QString name;                 ///< Parameter name
+    std::vector<double> values;   ///< Values to try
+};
+
+/**
+ * @brief Aggregated outcome of the matches of one parameter set
+ */
+struct SetStats {
+    long long matches = 0;        ///< Matches played
+    long long timeouts = 0;       ///< Matches stopped at the tick limit
+    long long ticks = 0;          ///< Ticks played
+    long long killTicks = 0;      ///< Sum of first-kill ticks
+    long long kills = 0;          ///< Matches with a kill
+    std::vector<long long> wins;  ///< Wins per team (index 0: draws)
+};
+
+/**
+ * @brief Parse "NAME=start:stop:step" (or "NAME=value")
+ * @param text Sweep specification
+ * @param axis Receives the axis
+ * @return bool Whether the specification is valid
+ */
+bool parseSweep(const QString& text, SweepAxis& axis) {
+    QStringList parts = text.split('=');
+    if (parts.size() != 2) return false;
+    
+    QStringList range = parts[1].split(':');
+    bool ok = true;
+    double start = range[0].toDouble(&ok);
+    double stop = start;
+    double step = 1.0;
+    if (ok && range.size() >= 2) stop = range[1].toDouble(&ok);
+    if (ok && range.size() >= 3) step = range[2].toDouble(&ok);
+    if (!ok || range.size() > 3 || step <= 0.0 || stop < start) return false;
+    
+    axis.name = parts[0].trimmed();
+    axis.values.clear();
+    for (double value = start; value <= stop + step * 1e-9; value += step) {
+        axis.values.push_back(value);
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption sweepOption("sweep", "Swept parameter NAME=start:stop:step (repeatable; all "
+                                   "combinations are played).", "spec");
+    QCommandLineOption setOption("set", "Fixed overrides NAME=value,NAME=value.", "assignments");
+    QCommandLineOption matchesOption("matches", "Matches per parameter set.", "count", "10000");
+    QCommandLineOption playersOption("players", "Players per match.", "count", "2");
+    QCommandLineOption teamsOption("teams", "Teams per match (0: one per player).", "count", "0");
+    QCommandLineOption ticksOption("max-ticks", "Tick limit per match.", "count", "10800");
+    QCommandLineOption botsOption("bots", "Comma separated bot types, assigned to players round-robin.",
+                                  "types", "aggressive,collector");
+    QCommandLineOption threadsOption("threads", "Worker threads (0: one per core).", "count", "0");
+    QCommandLineOption levelOption("level", "Baked level file to run on.", "file");
+    QCommandLineOption seedOption("seed", "Base random seed.", "seed", "1");
+    parser.addOption(sweepOption);
+    parser.addOption(setOption);
+    parser.addOption(matchesOption);
+    parser.addOption(playersOption);
+    parser.addOption(teamsOption);
+    parser.addOption(ticksOption);
+    parser.addOption(botsOption);
+    parser.addOption(threadsOption);
+    parser.addOption(levelOption);
+    parser.addOption(seedOption);
+    parser.process(app);
+    
+    // Base match setup
+    MatchSetup base;
+    base.players = std::max(2, parser.value(playersOption).toInt());
+    base.teams = std::max(0, parser.value(teamsOption).toInt());
+    base.maxTicks = std::max(1, parser.value(ticksOption).toInt());
+    base.bots.clear();
+    for (const QString& name : parser.value(botsOption).split(',', Qt::SkipEmptyParts)) {
+        BotType type;
+        if (!parseBotType(name.trimmed(), type)) {
+            std::fprintf(stderr, "Unknown bot type: %s\n", qPrintable(name));
+            return 1;
+        }
+        base.bots.push_back(type);
+    }
+    if (base.bots.empty()) {
+        std::fprintf(stderr, "No bot types given\n");
+        return 1;
+    }
+    QString error;
+    if (!base.balance.parse(parser.value(setOption), &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return 1;
+    }
+    
+    // Expand the sweep axes into parameter sets
+    std::vector<SweepAxis> axes;
+    for (const QString& spec : parser.values(sweepOption)) {
+        SweepAxis axis;
+        if (!parseSweep(spec, axis)) {
+            std::fprintf(stderr, "Invalid sweep: %s\n", qPrintable(spec));
+            return 1;
+        }
+        BalanceConfig probe(base.balance);
+        for (double value : axis.values) {
+            if (!probe.set(axis.name, value, &error)) {
+                std::fprintf(stderr, "%s\n", qPrintable(error));
+                return 1;
+            }
+        }
+        axes.push_back(axis);
+    }
+    
+    std::vector<MatchSetup> setups(1, base);
+    std::vector<std::vector<double>> setValues(1);
+    for (const SweepAxis& axis : axes) {
+        std::vector<MatchSetup> expanded;
+        std::vector<std::vector<double>> expandedValues;
+        for (std::size_t i = 0; i < setups.size(); ++i) {
+            for (double value : axis.values) {
+                expanded.push_back(setups[i]);
+                expanded.back().balance.set(axis.name, value);
+                expandedValues.push_back(setValues[i]);
+                expandedValues.back().push_back(value);
+            }
+        }
+        setups.swap(expanded);
+        setValues.swap(expandedValues);
+    }
+    
+    long long matchesPerSet = std::max(1, parser.value(matchesOption).toInt());
+    long long totalMatches = matchesPerSet * static_cast<long long>(setups.size());
+    int teamCount = std::clamp(base.teams > 0 ? base.teams : base.players, 2,
+                               std::min(base.players, GameConfig::MAX_TEAMS));
+    QString levelPath = parser.value(levelOption);
+    unsigned int seed = parser.value(seedOption).toUInt();
+    
+    int threadCount = parser.value(threadsOption).toInt();
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    threadCount = static_cast<int>(std::min<long long>(threadCount, totalMatches));
+    
+    // Workers pull matches from a shared counter; each keeps its own per-set statistics
+    SetStats empty;
+    empty.wins.assign(teamCount + 1, 0);
+    std::vector<std::vector<SetStats>> workerStats(threadCount, std::vector<SetStats>(setups.size(), empty));
+    std::atomic<long long> nextMatch(0);
+    std::vector<std::thread> workers;
+    
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&, t]() {
+            MatchRunner runner;
+            if (!levelPath.isEmpty()) {
+                runner.loadLevel(levelPath);
+            }
+            
+            for (long long job = nextMatch++; job < totalMatches; job = nextMatch++) {
+                // Every set replays the same seeds, so differences come from the parameters
+                std::size_t set = static_cast<std::size_t>(job / matchesPerSet);
+                MatchResult outcome = runner.run(setups[set], seed, static_cast<std::uint64_t>(job % matchesPerSet));
+                
+                SetStats& stats = workerStats[t][set];
+                stats.matches++;
+                stats.ticks += outcome.ticks;
+                if (outcome.timedOut) {
+                    stats.timeouts++;
+                } else {
+                    stats.wins[outcome.winner]++;
+                }
+                if (outcome.firstKillTick >= 0) {
+                    stats.killTicks += outcome.firstKillTick;
+                    stats.kills++;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    
+    // One CSV row per parameter set
+    for (const SweepAxis& axis : axes) {
+        std::printf("%s,", qPrintable(axis.name));
+    }
+    std::printf("matches");
+    for (int team = 1; team <= teamCount; ++team) {
+        std::printf(",team%d_win_rate", team);
+    }
+    std::printf(",draw_rate,timeout_rate,time_to_kill_s,match_length_s\n");
+    
+    const double tickSeconds = 1.0 / GameConfig::TARGET_FPS;
+    for (std::size_t set = 0; set < setups.size(); ++set) {
+        SetStats total = empty;
+        for (const std::vector<SetStats>& stats : workerStats) {
+            total.matches += stats[set].matches;
+            total.timeouts += stats[set].timeouts;
+            total.ticks += stats[set].ticks;
+            total.killTicks += stats[set].killTicks;
+            total.kills += stats[set].kills;
+            for (int team = 0; team <= teamCount; ++team) {
+                total.wins[team] += stats[set].wins[team];
+            }
+        }
+        
+        double matches = static_cast<double>(total.matches);
+        for (double value : setValues[set]) {
+            std::printf("%g,", value);
+        }
+        std::printf("%lld", total.matches);
+        for (int team = 1; team <= teamCount; ++team) {
+            std::printf(",%.4f", total.wins[team] / matches);
+        }
+        std::printf(",%.4f,%.4f,%.3f,%.3f\n", total.wins[0] / matches, total.timeouts / matches,
+                    total.kills > 0 ? total.killTicks * tickSeconds / total.kills : 0.0,
+                    total.ticks * tickSeconds / matches);
+    }
+    
+    return 0;
+}
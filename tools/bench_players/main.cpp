@@ -0,0 +1,121 @@
+/**
+ * @file main.cpp
+ * @brief Player count scaling benchmark
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "GameEngine.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Tick timings of one player count
+ */
+struct BenchResult {
+    int players;          ///< Player count
+    double meanUs;        ///< Mean tick time (microseconds)
+    double p50Us;         ///< Median tick time (microseconds)
+    double p99Us;         ///< 99th percentile tick time (microseconds)
+};
+
+/**
+ * @brief Run the engine with random input and measure tick times
+ * @param players Player count
+ * @param ticks Measured ticks
+ * @param levelPath Level file (empty for the built-in arena)
+ * @param threads Threads the engine updates on
+ * @return BenchResult Tick timings
+ */
+BenchResult runBenchmark(int players, int ticks, const QString& levelPath, int threads) {
+    GameEngine engine;
+    if (!levelPath.isEmpty()) {
+        engine.loadLevel(levelPath);
+    }
+    engine.setPlayerCount(players);
+    engine.setThreadCount(threads);
+    
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<int> actionDist(0, 31);
+    
+    auto startRound = [&]() {
+        engine.initialize();
+        // Ranged weapons so projectiles are part of the load
+        for (const auto& player : engine.getPlayers()) {
+            player->setWeapon(WeaponState::create(WeaponType::RIFLE));
+        }
+    };
+    startRound();
+    
+    const double deltaTime = 1.0 / GameConfig::TARGET_FPS;
+    const int warmupTicks = 120;
+    std::vector<double> samples;
+    samples.reserve(ticks);
+    
+    for (int tick = 0; tick < warmupTicks + ticks; ++tick) {
+        if (engine.getGameState() == GameState::GAME_OVER) {
+            startRound();
+        }
+        
+        // Every player changes its held actions every 10 ticks on average
+        for (int i = 0; i < players; ++i) {
+            if (actionDist(random) < 3) {
+                engine.setPlayerActions(i, static_cast<ActionMask>(actionDist(random)));
+            }
+        }
+        
+        auto start = std::chrono::steady_clock::now();
+        engine.update(deltaTime);
+        auto end = std::chrono::steady_clock::now();
+        
+        if (tick >= warmupTicks) {
+            samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+    }
+    
+    BenchResult result{players, 0.0, 0.0, 0.0};
+    for (double sample : samples) {
+        result.meanUs += sample;
+    }
+    result.meanUs /= samples.size();
+    std::sort(samples.begin(), samples.end());
+    result.p50Us = samples[samples.size() / 2];
+    result.p99Us = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption ticksOption("ticks", "Measured ticks per player count.", "count", "2000");
+    QCommandLineOption levelOption("level", "Baked level file to run on.", "file");
+    QCommandLineOption threadsOption("threads", "Threads per engine update (0: one per core).", "count", "1");
+    parser.addOption(ticksOption);
+    parser.addOption(levelOption);
+    parser.addOption(threadsOption);
+    parser.process(app);
+    
+    int ticks = std::max(1, parser.value(ticksOption).toInt());
+    QString levelPath = parser.value(levelOption);
+    int threads = std::max(0, parser.value(threadsOption).toInt());
+    
+    std::printf("%8s %12s %12s %12s %16s\n", "players", "mean(us)", "p50(us)", "p99(us)", "per player(us)");
+    for (int players : {2, 16, 64, 256}) {
+        BenchResult result = runBenchmark(players, ticks, levelPath, threads);
+        std::printf("%8d %12.2f %12.2f %12.2f %16.3f\n", result.players, result.meanUs, result.p50Us,
+                    result.p99Us, result.meanUs / result.players);
+    }
+    
+    return 0;
+}
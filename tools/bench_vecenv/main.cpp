@@ -0,0 +1,101 @@
+/**
+ * @file main.cpp
+ * @brief Vectorized environment throughput benchmark
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "VecEnv.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption envsOption("envs", "Environments stepped in lockstep.", "count", "256");
+    QCommandLineOption threadsOption("threads", "Threads (0: one per core).", "count", "0");
+    QCommandLineOption stepsOption("steps", "Measured steps.", "count", "2000");
+    QCommandLineOption playersOption("players", "Players per environment.", "count", "2");
+    QCommandLineOption agentsOption("agents", "Agent players per environment.", "count", "1");
+    QCommandLineOption levelOption("level", "Baked level file to run on.", "file");
+    QCommandLineOption pixelsOption("pixels", "Also render pixel observations of this size, e.g. 84x56.", "WxH");
+    QCommandLineOption rgbOption("rgb", "Render RGB pixel observations instead of grayscale.");
+    parser.addOption(envsOption);
+    parser.addOption(threadsOption);
+    parser.addOption(stepsOption);
+    parser.addOption(playersOption);
+    parser.addOption(agentsOption);
+    parser.addOption(levelOption);
+    parser.addOption(pixelsOption);
+    parser.addOption(rgbOption);
+    parser.process(app);
+    
+    VecEnvConfig config;
+    config.envCount = std::max(1, parser.value(envsOption).toInt());
+    config.threads = std::max(0, parser.value(threadsOption).toInt());
+    config.players = std::max(2, parser.value(playersOption).toInt());
+    config.agents = std::max(1, parser.value(agentsOption).toInt());
+    int steps = std::max(1, parser.value(stepsOption).toInt());
+    if (parser.isSet(pixelsOption)) {
+        QStringList size = parser.value(pixelsOption).split('x');
+        if (size.size() != 2 || size[0].toInt() <= 0 || size[1].toInt() <= 0) {
+            std::fprintf(stderr, "Invalid pixel size: %s\n", qPrintable(parser.value(pixelsOption)));
+            return 1;
+        }
+        config.pixelWidth = size[0].toInt();
+        config.pixelHeight = size[1].toInt();
+        config.pixelFormat = parser.isSet(rgbOption) ? PixelFormat::RGB888 : PixelFormat::GRAY8;
+    }
+    
+    VecEnv env(config);
+    if (parser.isSet(levelOption)) {
+        QString error;
+        if (!env.loadLevel(parser.value(levelOption), &error)) {
+            std::fprintf(stderr, "Failed to load level: %s\n", qPrintable(error));
+            return 1;
+        }
+    }
+    
+    // Pre-generated random actions, so the loop measures the environment only
+    const int actionSets = 64;
+    std::size_t rows = static_cast<std::size_t>(env.getEnvCount()) * env.getAgentCount();
+    std::vector<ActionMask> actions(rows * actionSets);
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<int> actionDist(0, 31);
+    for (ActionMask& action : actions) {
+        action = static_cast<ActionMask>(actionDist(random));
+    }
+    
+    long long episodes = 0;
+    double rewardSum = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (int step = 0; step < steps; ++step) {
+        env.step(&actions[(step / 10 % actionSets) * rows]);
+        for (int i = 0; i < env.getEnvCount(); ++i) {
+            episodes += env.getDones()[i];
+        }
+        for (std::size_t i = 0; i < rows; ++i) {
+            rewardSum += env.getRewards()[i];
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    long long envSteps = static_cast<long long>(steps) * env.getEnvCount();
+    std::printf("envs: %d, threads: %d, observation: %d floats\n", env.getEnvCount(), env.getThreadCount(),
+                env.getObservationSize());
+    if (env.getPixelFrameSize() > 0) {
+        std::printf("pixel observation: %dx%d, %zu bytes\n", config.pixelWidth, config.pixelHeight,
+                    env.getPixelFrameSize());
+    }
+    std::printf("env steps: %lld in %.2f s (%.0f steps/s)\n", envSteps, seconds, envSteps / seconds);
+    std::printf("episodes finished: %lld, mean reward per step: %.5f\n", episodes, rewardSum / (envSteps * env.getAgentCount()));
+    
+    return 0;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file main.cpp
+ * @brief qtgame_levelc level baker entry point
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "LevelBaker.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: qtgame_levelc <source.txt> <output.qlvl>" << std::endl;
+        return 2;
+    }
+    
+    std::ifstream input(argv[1]);
+    if (!input) {
+        std::cerr << argv[1] << ": cannot open" << std::endl;
+        return 1;
+    }
+    std::stringstream source;
+    source << input.rdbuf();
+    
+    LevelBaker baker;
+    std::string error;
+    if (!baker.parseText(source.str(), error)) {
+        std::cerr << argv[1] << ": " << error << std::endl;
+        return 1;
+    }
+    
+    std::vector<unsigned char> data;
+    if (!baker.bake(data, error)) {
+        std::cerr << argv[1] << ": " << error << std::endl;
+        return 1;
+    }
+    
+    std::ofstream output(argv[2], std::ios::binary | std::ios::trunc);
+    if (!output.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()))) {
+        std::cerr << argv[2] << ": write failed" << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,321 @@
+/**
+ * @file main.cpp
+ * @brief Golden-image check of PixelRenderer against a QPainter reference
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "GameEngine.h"
+#include "PixelRenderer.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QImage>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QStringList>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Check parameters
+ */
+struct CheckConfig {
+    int players;            ///< Players per match
+    int width;              ///< Pixel frame width
+    int height;             ///< Pixel frame height
+    Vector2D viewSize;      ///< World size shown in a frame
+    int ticks;              ///< Ticks simulated
+    int interval;           ///< Ticks between checked states
+    int tolerance;          ///< Largest channel difference accepted per pixel
+    unsigned int seed;      ///< Random seed
+};
+
+/**
+ * @brief Comparison result of one frame
+ */
+struct FrameResult {
+    int mismatches;     ///< Pixels over the tolerance
+    int maxError;       ///< Largest channel difference of the closest candidate
+};
+
+/**
+ * @brief Draw the layers PixelRenderer draws, the way GameWindow draws them
+ *
+ * Outlines, text and the eye indicator are left out, as PixelRenderer leaves them out.
+ * @param engine The engine
+ * @param originX View origin x (world pixels)
+ * @param originY View origin y (world pixels)
+ * @param image Receives the view at one pixel per world pixel
+ */
+void drawReference(const GameEngine& engine, int originX, int originY, QImage& image) {
+    QPainter painter(&image);
+    
+    QLinearGradient gradient(0, 0, 0, image.height());
+    gradient.setColorAt(0, QColor(135, 206, 235));
+    gradient.setColorAt(1, QColor(176, 224, 230));
+    painter.fillRect(image.rect(), gradient);
+    
+    painter.translate(-originX, -originY);
+    painter.setPen(Qt::NoPen);
+    
+    const Level& level = engine.getLevel();
+    for (std::uint32_t index : engine.getStreamer().getActivePlatforms()) {
+        const LevelFormat::PlatformRecord& platform = level.getPlatform(index);
+        painter.setBrush(QColor::fromRgb(platform.color));
+        painter.drawRect(static_cast<int>(platform.x), static_cast<int>(platform.y),
+                         static_cast<int>(platform.width), static_cast<int>(platform.height));
+    }
+    
+    for (const auto& player : engine.getPlayers()) {
+        if (!player->isAlive()) continue;
+        
+        Vector2D pos = player->getPosition();
+        QColor playerColor = QColor::fromRgb(player->getColor());
+        if (player->isInvisible()) {
+            playerColor.setAlpha(100);
+        }
+        painter.setBrush(playerColor);
+        
+        QRect playerRect(static_cast<int>(pos.x), static_cast<int>(pos.y),
+                         static_cast<int>(player->getWidth()), static_cast<int>(player->getHeight()));
+        if (player->getState() == PlayerState::CROUCHING) {
+            playerRect.setY(static_cast<int>(pos.y + player->getHeight() * 0.4));
+            playerRect.setHeight(static_cast<int>(player->getHeight() * 0.6));
+            playerRect.setWidth(static_cast<int>(player->getWidth() * 1.2));
+        }
+        painter.drawRect(playerRect);
+        
+        painter.setBrush(QColor::fromRgb(player->getWeapon().getColor()));
+        int weaponX = player->isFacingRight() ? static_cast<int>(pos.x + player->getWidth()) : static_cast<int>(pos.x - 15);
+        int weaponY = static_cast<int>(pos.y + player->getHeight() * 0.5);
+        switch (player->getWeapon().getType()) {
+            case WeaponType::FIST:
+                painter.drawEllipse(weaponX - 5, weaponY - 5, 10, 10);
+                break;
+            case WeaponType::KNIFE:
+                painter.drawRect(weaponX - 2, weaponY - 8, 4, 16);
+                break;
+            case WeaponType::BALL:
+                painter.drawEllipse(weaponX - 6, weaponY - 6, 12, 12);
+                break;
+            case WeaponType::RIFLE:
+                painter.drawRect(weaponX - 15, weaponY - 3, 30, 6);
+                break;
+            case WeaponType::SNIPER:
+                painter.drawRect(weaponX - 20, weaponY - 4, 40, 8);
+                break;
+        }
+    }
+    
+    const EntityWorld& world = engine.getWorld();
+    for (std::size_t i = 0; i < world.sprites.size(); ++i) {
+        const Bounds& box = world.bounds.get(world.sprites.entityAt(i));
+        const Sprite& sprite = world.sprites.at(i);
+        painter.setBrush(QColor::fromRgb(sprite.color));
+        
+        int x = static_cast<int>(box.min.x);
+        int y = static_cast<int>(box.min.y);
+        int w = static_cast<int>(box.max.x - box.min.x);
+        int h = static_cast<int>(box.max.y - box.min.y);
+        if (sprite.shape == SpriteShape::ELLIPSE) {
+            painter.drawEllipse(x, y, w, h);
+        } else {
+            painter.drawRect(x, y, w, h);
+        }
+    }
+}
+
+/**
+ * @brief Largest channel difference between two colors
+ * @param a First color (0xRRGGBB)
+ * @param r Red of the second color
+ * @param g Green of the second color
+ * @param b Blue of the second color
+ * @return int Difference (0-255)
+ */
+int colorDistance(QRgb a, int r, int g, int b) {
+    return std::max({std::abs(qRed(a) - r), std::abs(qGreen(a) - g), std::abs(qBlue(a) - b)});
+}
+
+/**
+ * @brief Compare a pixel frame with a reference view
+ *
+ * The reference is downsampled over the world pixels each frame pixel covers (the mapping
+ * PixelRenderer uses). PixelRenderer snaps edges to whole pixels and keeps small objects one
+ * pixel large, so a frame pixel matches when it is within the tolerance of the downsampled
+ * color or of any reference pixel in its footprint grown by one frame pixel.
+ * @param frame RGB888 frame
+ * @param width Frame width
+ * @param height Frame height
+ * @param reference Reference view
+ * @param tolerance Largest channel difference accepted
+ * @return FrameResult Mismatching pixels and largest error
+ */
+FrameResult compare(const std::vector<std::uint8_t>& frame, int width, int height, const QImage& reference,
+                    int tolerance) {
+    FrameResult result{0, 0};
+    const int viewWidth = reference.width();
+    const int viewHeight = reference.height();
+    
+    for (int py = 0; py < height; ++py) {
+        int y0 = py * viewHeight / height;
+        int y1 = std::max(y0 + 1, (py + 1) * viewHeight / height);
+        for (int px = 0; px < width; ++px) {
+            int x0 = px * viewWidth / width;
+            int x1 = std::max(x0 + 1, (px + 1) * viewWidth / width);
+            
+            // Box filter over the footprint
+            long long sum[3] = {0, 0, 0};
+            for (int y = y0; y < y1; ++y) {
+                const QRgb* line = reinterpret_cast<const QRgb*>(reference.constScanLine(y));
+                for (int x = x0; x < x1; ++x) {
+                    sum[0] += qRed(line[x]);
+                    sum[1] += qGreen(line[x]);
+                    sum[2] += qBlue(line[x]);
+                }
+            }
+            long long area = static_cast<long long>(x1 - x0) * (y1 - y0);
+            QRgb average = qRgb(static_cast<int>(sum[0] / area), static_cast<int>(sum[1] / area),
+                                static_cast<int>(sum[2] / area));
+            
+            const std::uint8_t* pixel = &frame[(static_cast<std::size_t>(py) * width + px) * 3];
+            int error = colorDistance(average, pixel[0], pixel[1], pixel[2]);
+            
+            int nearY0 = std::max(0, (py - 1) * viewHeight / height);
+            int nearY1 = std::min(viewHeight, (py + 2) * viewHeight / height + 1);
+            int nearX0 = std::max(0, (px - 1) * viewWidth / width);
+            int nearX1 = std::min(viewWidth, (px + 2) * viewWidth / width + 1);
+            for (int y = nearY0; y < nearY1 && error > tolerance; ++y) {
+                const QRgb* line = reinterpret_cast<const QRgb*>(reference.constScanLine(y));
+                for (int x = nearX0; x < nearX1; ++x) {
+                    error = std::min(error, colorDistance(line[x], pixel[0], pixel[1], pixel[2]));
+                }
+            }
+            
+            result.maxError = std::max(result.maxError, error);
+            if (error > tolerance) result.mismatches++;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption playersOption("players", "Players per match.", "count", "4");
+    QCommandLineOption pixelsOption("pixels", "Pixel frame size.", "WxH", "84x56");
+    QCommandLineOption viewOption("view", "World size shown in a frame.", "WxH",
+                                  QString("%1x%2").arg(GameConfig::WINDOW_WIDTH).arg(GameConfig::WINDOW_HEIGHT));
+    QCommandLineOption ticksOption("ticks", "Ticks simulated.", "count", "3600");
+    QCommandLineOption intervalOption("interval", "Ticks between checked states.", "count", "300");
+    QCommandLineOption toleranceOption("tolerance", "Largest channel difference accepted per pixel.", "value", "24");
+    QCommandLineOption levelOption("level", "Baked level file to run on.", "file");
+    QCommandLineOption seedOption("seed", "Random seed.", "seed", "1");
+    QCommandLineOption outputOption("output", "Directory receiving the reference and frame of mismatching views.", "dir");
+    parser.addOption(playersOption);
+    parser.addOption(pixelsOption);
+    parser.addOption(viewOption);
+    parser.addOption(ticksOption);
+    parser.addOption(intervalOption);
+    parser.addOption(toleranceOption);
+    parser.addOption(levelOption);
+    parser.addOption(seedOption);
+    parser.addOption(outputOption);
+    parser.process(app);
+    
+    CheckConfig config;
+    config.players = std::max(2, parser.value(playersOption).toInt());
+    config.ticks = std::max(1, parser.value(ticksOption).toInt());
+    config.interval = std::max(1, parser.value(intervalOption).toInt());
+    config.tolerance = std::max(0, parser.value(toleranceOption).toInt());
+    config.seed = parser.value(seedOption).toUInt();
+    
+    QStringList pixels = parser.value(pixelsOption).split('x');
+    QStringList view = parser.value(viewOption).split('x');
+    if (pixels.size() != 2 || pixels[0].toInt() <= 0 || pixels[1].toInt() <= 0) {
+        std::fprintf(stderr, "Invalid pixel size: %s\n", qPrintable(parser.value(pixelsOption)));
+        return 1;
+    }
+    if (view.size() != 2 || view[0].toInt() < pixels[0].toInt() || view[1].toInt() < pixels[1].toInt()) {
+        std::fprintf(stderr, "Invalid view size (at least the pixel size): %s\n", qPrintable(parser.value(viewOption)));
+        return 1;
+    }
+    config.width = pixels[0].toInt();
+    config.height = pixels[1].toInt();
+    config.viewSize = Vector2D(view[0].toInt(), view[1].toInt());
+    
+    GameEngine engine;
+    QString error;
+    if (parser.isSet(levelOption) && !engine.loadLevel(parser.value(levelOption), &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return 1;
+    }
+    engine.setSeed(config.seed);
+    engine.setPlayerCount(config.players, 0);
+    const BotType bots[] = {BotType::AGGRESSIVE, BotType::ITEM_COLLECTOR, BotType::RANDOM};
+    for (int i = 0; i < config.players; ++i) {
+        engine.setBot(i, createBot(bots[i % 3], config.seed, i));
+    }
+    engine.initialize();
+    engine.startGame();
+    
+    PixelRenderer renderer(config.width, config.height, PixelFormat::RGB888);
+    std::vector<std::uint8_t> frame(renderer.getFrameSize());
+    QImage reference(static_cast<int>(config.viewSize.x), static_cast<int>(config.viewSize.y), QImage::Format_RGB32);
+    if (parser.isSet(outputOption)) {
+        QDir().mkpath(parser.value(outputOption));
+    }
+    
+    int views = 0;
+    int failedViews = 0;
+    int worstError = 0;
+    for (int tick = 1; tick <= config.ticks; ++tick) {
+        // Rounds end within a few hundred ticks; a new one keeps every checked state in play
+        if (engine.getGameState() == GameState::GAME_OVER) {
+            engine.initialize();
+            engine.startGame();
+        }
+        engine.update(1.0 / GameConfig::TARGET_FPS);
+        if (tick % config.interval != 0) continue;
+        
+        // One view per player, as VecEnv renders them
+        for (int player = 0; player < config.players; ++player) {
+            Vector2D origin = PixelRenderer::followPlayer(engine, player, config.viewSize);
+            renderer.render(engine, origin, config.viewSize, frame.data());
+            int originX = static_cast<int>(std::floor(origin.x));
+            int originY = static_cast<int>(std::floor(origin.y));
+            drawReference(engine, originX, originY, reference);
+            
+            FrameResult result = compare(frame, config.width, config.height, reference, config.tolerance);
+            views++;
+            worstError = std::max(worstError, result.maxError);
+            if (result.mismatches == 0) continue;
+            
+            failedViews++;
+            std::printf("tick %d player %d (origin %d,%d): %d pixels over tolerance, max error %d\n",
+                        tick, player, originX, originY, result.mismatches, result.maxError);
+            if (parser.isSet(outputOption)) {
+                QString base = QString("%1/tick%2_player%3").arg(parser.value(outputOption)).arg(tick).arg(player);
+                reference.save(base + "_reference.png");
+                QImage(frame.data(), config.width, config.height, config.width * 3, QImage::Format_RGB888)
+                    .save(base + "_frame.png");
+            }
+        }
+    }
+    
+    std::printf("views: %d (%dx%d of %dx%d world pixels), over tolerance %d: %d, max error: %d\n",
+                views, config.width, config.height, static_cast<int>(config.viewSize.x),
+                static_cast<int>(config.viewSize.y), config.tolerance, failedViews, worstError);
+    
+    return failedViews == 0 && views > 0 ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file main.c
+ * @brief Plain C host of the simulation library: snapshot replay check and throughput
+ * @author Justin0828
+ * @date 2026-10-17
+ *
+ * Plays matches with scripted random actions and random bots, snapshots each one halfway,
+ * finishes it, restores the snapshot and replays the second half. The replay must end in exactly the
+ * same player states. Written in C to keep the library's C API honest.
+ */
+
+#include "QtGameSim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_PLAYERS 64
+
+/**
+ * @brief Scripted action of a player, changing every 10 ticks
+ * @param seed Match seed
+ * @param tick Tick since the start of the round
+ * @param player Player index
+ * @return uint8_t Action mask
+ */
+static uint8_t scriptedAction(uint32_t seed, int64_t tick, int player) {
+    uint32_t hash = seed * 2654435761u ^ (uint32_t)(tick / 10) * 2246822519u ^ (uint32_t)player * 3266489917u;
+    hash ^= hash >> 15;
+    hash *= 2246822519u;
+    hash ^= hash >> 13;
+    return (uint8_t)(hash & 31u);
+}
+
+/**
+ * @brief Simulate until a tick is reached or the round ends
+ * @param match The match
+ * @param seed Match seed (selects the scripted actions)
+ * @param players Number of players
+ * @param until Tick to stop at
+ * @return long long Ticks simulated
+ */
+static long long playUntil(qtgame_match* match, uint32_t seed, int players, int64_t until) {
+    uint8_t actions[MAX_PLAYERS];
+    qtgame_match_state state;
+    long long ticks = 0;
+    
+    qtgame_read_match(match, &state);
+    while (state.tick < until && state.state == QTGAME_STATE_PLAYING) {
+        for (int player = 0; player < players; ++player) {
+            actions[player] = scriptedAction(seed, state.tick, player);
+        }
+        qtgame_step(match, actions, 1);
+        qtgame_read_match(match, &state);
+        ticks++;
+    }
+    return ticks;
+}
+
+int main(int argc, char* argv[]) {
+    int matches = 64;
+    int ticks = 3600;
+    int players = 2;
+    int bots = 1;
+    const char* level = NULL;
+    
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--matches") == 0 && i + 1 < argc) {
+            matches = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc) {
+            ticks = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--players") == 0 && i + 1 < argc) {
+            players = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--bots") == 0 && i + 1 < argc) {
+            bots = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+            level = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--matches N] [--ticks N] [--players N] [--bots N] [--level FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (players < 2 || players > MAX_PLAYERS) {
+        fprintf(stderr, "--players must be between 2 and %d\n", MAX_PLAYERS);
+        return 2;
+    }
+    if (bots < 0 || bots > players) {
+        fprintf(stderr, "--bots must be between 0 and the number of players\n");
+        return 2;
+    }
+    if (qtgame_abi_version() != QTGAME_SIM_ABI_VERSION) {
+        fprintf(stderr, "library ABI %u, header ABI %u\n", (unsigned)qtgame_abi_version(), QTGAME_SIM_ABI_VERSION);
+        return 1;
+    }
+    
+    qtgame_player_state expected[MAX_PLAYERS];
+    qtgame_player_state replayed[MAX_PLAYERS];
+    void* snapshot = NULL;
+    size_t snapshotCapacity = 0;
+    size_t snapshotBytes = 0;
+    long long simulated = 0;
+    int mismatches = 0;
+    clock_t start = clock();
+    
+    for (int m = 0; m < matches; ++m) {
+        qtgame_config config = {players, 0, (uint32_t)m + 1, level, NULL};
+        char error[256];
+        qtgame_match* match = qtgame_create(&config, error, sizeof(error));
+        if (!match) {
+            fprintf(stderr, "qtgame_create failed: %s\n", error);
+            return 1;
+        }
+        
+        // The first players are driven by random bots, whose memory must travel with the snapshot
+        for (int player = 0; player < bots; ++player) {
+            qtgame_set_bot(match, player, QTGAME_BOT_RANDOM);
+        }
+        
+        simulated += playUntil(match, config.seed, players, ticks / 2);
+        
+        // The caller owns the snapshot buffer; it only grows when a snapshot needs more room
+        size_t size = qtgame_snapshot(match, NULL, 0);
+        if (size > snapshotCapacity) {
+            free(snapshot);
+            snapshotCapacity = size * 2;
+            snapshot = malloc(snapshotCapacity);
+        }
+        qtgame_snapshot(match, snapshot, snapshotCapacity);
+        snapshotBytes += size;
+        
+        simulated += playUntil(match, config.seed, players, ticks);
+        qtgame_read_players(match, expected, MAX_PLAYERS);
+        
+        if (qtgame_restore(match, snapshot, size) != 0) {
+            fprintf(stderr, "match %d: snapshot did not restore\n", m);
+            mismatches++;
+        } else {
+            simulated += playUntil(match, config.seed, players, ticks);
+            qtgame_read_players(match, replayed, MAX_PLAYERS);
+            if (memcmp(expected, replayed, sizeof(qtgame_player_state) * (size_t)players) != 0) {
+                fprintf(stderr, "match %d: replay diverged from the original\n", m);
+                mismatches++;
+            }
+        }
+        qtgame_destroy(match);
+    }
+    free(snapshot);
+    
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("matches: %d, ticks simulated: %lld in %.2f s (%.0f ticks/s)\n", matches, simulated, seconds,
+           seconds > 0 ? simulated / seconds : 0.0);
+    printf("mean snapshot: %.0f bytes, replay mismatches: %d\n", matches > 0 ? (double)snapshotBytes / matches : 0.0,
+           mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
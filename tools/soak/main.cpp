@@ -0,0 +1,167 @@
+/**
+ * @file main.cpp
+ * @brief Headless bot soak test
+ * @author Justin0828
+ * @date 2026-10-17
+ */
+
+#include "MatchRunner.h"
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QStringList>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Soak run parameters
+ */
+struct SoakConfig {
+    int matches;                  ///< Matches to play
+    MatchSetup setup;             ///< Parameters of every match
+    QString levelPath;            ///< Level file (empty for the built-in arena)
+    unsigned int seed;            ///< Base random seed
+};
+
+/**
+ * @brief Results of the matches played by one worker
+ */
+struct SoakResult {
+    long long ticks = 0;                                  ///< Simulated ticks
+    int matches = 0;                                      ///< Finished matches
+    int timeouts = 0;                                     ///< Matches stopped at the tick limit
+    int violations = 0;                                   ///< Ticks breaking a state invariant
+    std::vector<int> wins = std::vector<int>(GameConfig::MAX_TEAMS + 1, 0); ///< Wins per team (index 0: draws)
+};
+
+/**
+ * @brief Play matches until the shared match counter runs out
+ * @param config Run parameters
+ * @param nextMatch Shared index of the next match to play
+ * @param result Receives the results
+ */
+void runWorker(const SoakConfig& config, std::atomic<int>& nextMatch, SoakResult& result) {
+    MatchRunner runner;
+    if (!config.levelPath.isEmpty()) {
+        runner.loadLevel(config.levelPath);
+    }
+    
+    for (int match = nextMatch++; match < config.matches; match = nextMatch++) {
+        // Random streams depend only on the match index, so runs are reproducible with any thread count
+        MatchResult outcome = runner.run(config.setup, config.seed, static_cast<std::uint64_t>(match));
+        
+        result.ticks += outcome.ticks;
+        result.matches++;
+        result.violations += outcome.violations;
+        if (outcome.timedOut) {
+            result.timeouts++;
+        } else {
+            result.wins[outcome.winner]++;
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption matchesOption("matches", "Matches to play.", "count", "1000");
+    QCommandLineOption playersOption("players", "Players per match.", "count", "2");
+    QCommandLineOption teamsOption("teams", "Teams per match (0: one per player).", "count", "0");
+    QCommandLineOption ticksOption("max-ticks", "Tick limit per match.", "count", "10800");
+    QCommandLineOption tickRateOption("tick-rate", "Fixed simulation steps per second.", "hz",
+                                      QString::number(GameConfig::TARGET_FPS));
+    QCommandLineOption botsOption("bots", "Comma separated bot types (aggressive, collector, random), "
+                                  "assigned to players round-robin.", "types", "aggressive,collector,random");
+    QCommandLineOption threadsOption("threads", "Worker threads (0: one per core).", "count", "0");
+    QCommandLineOption levelOption("level", "Baked level file to run on.", "file");
+    QCommandLineOption seedOption("seed", "Base random seed.", "seed", "1");
+    parser.addOption(matchesOption);
+    parser.addOption(playersOption);
+    parser.addOption(teamsOption);
+    parser.addOption(ticksOption);
+    parser.addOption(tickRateOption);
+    parser.addOption(botsOption);
+    parser.addOption(threadsOption);
+    parser.addOption(levelOption);
+    parser.addOption(seedOption);
+    parser.process(app);
+    
+    SoakConfig config;
+    config.matches = std::max(1, parser.value(matchesOption).toInt());
+    config.setup.players = std::max(2, parser.value(playersOption).toInt());
+    config.setup.teams = std::max(0, parser.value(teamsOption).toInt());
+    config.setup.maxTicks = std::max(1, parser.value(ticksOption).toInt());
+    config.setup.tickRate = std::max(1, parser.value(tickRateOption).toInt());
+    config.setup.checkInvariants = true;
+    config.levelPath = parser.value(levelOption);
+    config.seed = parser.value(seedOption).toUInt();
+    
+    config.setup.bots.clear();
+    for (const QString& name : parser.value(botsOption).split(',', Qt::SkipEmptyParts)) {
+        BotType type;
+        if (!parseBotType(name.trimmed(), type)) {
+            std::fprintf(stderr, "Unknown bot type: %s\n", qPrintable(name));
+            return 1;
+        }
+        config.setup.bots.push_back(type);
+    }
+    if (config.setup.bots.empty()) {
+        std::fprintf(stderr, "No bot types given\n");
+        return 1;
+    }
+    
+    int threadCount = parser.value(threadsOption).toInt();
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    threadCount = std::min(threadCount, config.matches);
+    
+    // Each worker owns one engine and plays matches back-to-back
+    std::atomic<int> nextMatch(0);
+    std::vector<SoakResult> results(threadCount);
+    std::vector<std::thread> workers;
+    
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(runWorker, std::cref(config), std::ref(nextMatch), std::ref(results[i]));
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    
+    SoakResult total;
+    for (const SoakResult& result : results) {
+        total.ticks += result.ticks;
+        total.matches += result.matches;
+        total.timeouts += result.timeouts;
+        total.violations += result.violations;
+        for (std::size_t team = 0; team < total.wins.size(); ++team) {
+            total.wins[team] += result.wins[team];
+        }
+    }
+    
+    std::printf("matches:        %d (%d threads, %.2f s)\n", total.matches, threadCount, seconds);
+    std::printf("ticks:          %lld at %d Hz (%.0f ticks/s, %.1fx real time)\n", total.ticks,
+                config.setup.tickRate, total.ticks / seconds, total.ticks / seconds / config.setup.tickRate);
+    std::printf("mean length:    %.1f ticks\n", static_cast<double>(total.ticks) / total.matches);
+    std::printf("timeouts:       %d\n", total.timeouts);
+    std::printf("draws:          %d\n", total.wins[0]);
+    for (std::size_t team = 1; team < total.wins.size(); ++team) {
+        if (total.wins[team] > 0) {
+            std::printf("team %-2zu wins:   %d\n", team, total.wins[team]);
+        }
+    }
+    std::printf("violations:     %d\n", total.violations);
+    
+    return total.violations == 0 ? 0 : 1;
+}